@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "DesignGenerator.h"
+#include <algorithm>
+#include <benchmark/benchmark.h>
+
+#include "slang/ast/ASTContext.h"
+#include "slang/ast/Compilation.h"
+#include "slang/ast/EvalContext.h"
+#include "slang/ast/Expression.h"
+#include "slang/ast/ScriptSession.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/syntax/AllSyntax.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+
+using namespace slang;
+using namespace slang::ast;
+using namespace slang::syntax;
+
+static void BM_GetRoot(benchmark::State& state) {
+    auto text = bench::generateDesign(size_t(state.range(0)));
+    SourceManager sourceManager;
+    auto tree = SyntaxTree::fromText(text, sourceManager);
+
+    for (auto _ : state) {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        benchmark::DoNotOptimize(&compilation.getRoot());
+    }
+}
+BENCHMARK(BM_GetRoot)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_FullElaboration(benchmark::State& state) {
+    auto text = bench::generateDesign(size_t(state.range(0)));
+    SourceManager sourceManager;
+    auto tree = SyntaxTree::fromText(text, sourceManager);
+
+    for (auto _ : state) {
+        Compilation compilation;
+        compilation.addSyntaxTree(tree);
+        compilation.getRoot();
+
+        // Collecting all diagnostics forces every instance body and
+        // lazily bound expression in the design to be elaborated.
+        auto& diags = compilation.getAllDiagnostics();
+        if (std::ranges::any_of(diags, [](auto& diag) { return diag.isError(); })) {
+            state.SkipWithError("generated design has errors");
+            break;
+        }
+    }
+}
+BENCHMARK(BM_FullElaboration)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
+
+static void BM_ConstantEval(benchmark::State& state, const char* expr) {
+    ScriptSession session;
+    session.eval(bench::generateConstantFunctions());
+
+    auto tree = SyntaxTree::fromText(expr);
+    auto& syntax = tree->root().as<ExpressionSyntax>();
+
+    ASTContext astCtx(session.scope, LookupLocation::max);
+    auto& bound = Expression::bind(syntax, astCtx);
+    if (bound.bad()) {
+        state.SkipWithError("failed to bind expression");
+        return;
+    }
+
+    for (auto _ : state) {
+        EvalContext evalCtx(astCtx);
+        auto result = bound.eval(evalCtx);
+        if (!result) {
+            state.SkipWithError("evaluation failed");
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+}
+BENCHMARK_CAPTURE(BM_ConstantEval, recursive_calls, "fib(12)")->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ConstantEval, dynamic_array_loop, "sieve(500)")
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_CAPTURE(BM_ConstantEval, wide_arithmetic, "crc(128'hdeadbeef, 100)")
+    ->Unit(benchmark::kMicrosecond);
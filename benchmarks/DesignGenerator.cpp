@@ -0,0 +1,186 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "DesignGenerator.h"
+
+#include <fmt/format.h>
+#include <iterator>
+
+namespace slang::bench {
+
+std::string generateDesign(size_t numModules) {
+    std::string result;
+    auto out = std::back_inserter(result);
+
+    for (size_t i = 0; i < numModules; i++) {
+        fmt::format_to(out, R"(
+module leaf_{0} #(parameter int W = 8, parameter int STAGES = 4) (
+    input logic clk,
+    input logic rst,
+    input logic [W-1:0] a,
+    input logic [W-1:0] b,
+    output logic [W-1:0] q
+);
+    typedef struct packed {{
+        logic [W-1:0] data;
+        logic valid;
+    }} entry_t;
+
+    entry_t acc;
+    logic [W-1:0] stage_out [STAGES];
+
+    function automatic logic [W-1:0] mix(logic [W-1:0] x, logic [W-1:0] y);
+        logic [W-1:0] r = x;
+        for (int k = 0; k < 4; k++)
+            r = (r << 1) ^ (y >> k);
+        return r;
+    endfunction
+
+    always_ff @(posedge clk) begin
+        if (rst) begin
+            acc <= '0;
+        end
+        else begin
+            acc.data <= acc.data + (a ^ b) * {1};
+            acc.valid <= |a;
+        end
+    end
+
+    for (genvar g = 0; g < STAGES; g++) begin : stage
+        if (g == 0) begin : first
+            assign stage_out[g] = mix(acc.data, b);
+        end
+        else begin : rest
+            assign stage_out[g] = mix(stage_out[g - 1], a) + W'(g);
+        end
+    end
+
+    always_comb begin
+        case (acc.valid)
+            1'b1: q = stage_out[STAGES - 1];
+            default: q = '0;
+        endcase
+    end
+endmodule
+)",
+                       i, (i % 7) + 1);
+    }
+
+    fmt::format_to(out, R"(
+module top;
+    localparam int W = 16;
+    logic clk, rst;
+    logic [W-1:0] a [{0}];
+    logic [W-1:0] q [{0}];
+)",
+                   numModules);
+
+    for (size_t i = 0; i < numModules; i++) {
+        fmt::format_to(out,
+                       "    leaf_{0} #(.W(W), .STAGES({1})) u{0}(.clk, .rst, .a(a[{0}]), "
+                       ".b(q[{2}]), .q(q[{0}]));\n",
+                       i, (i % 5) + 2, i ? i - 1 : 0);
+    }
+
+    result += "endmodule\n";
+    return result;
+}
+
+std::string generateMacroText(size_t numUses) {
+    std::string result = R"(
+`define ADD(a, b) ((a) + (b))
+`define MUL(a, b) ((a) * (b))
+`define MUX(s, a, b) ((s) ? (a) : (b))
+`define SAT(x, w) `MUX((x) > {w{1'b1}}, {w{1'b1}}, (x))
+`define DECL(name, w) logic [(w)-1:0] name;
+`define STR(x) `"x`"
+`define CAT(a, b) a``_``b
+
+module macros;
+    logic sel;
+    logic [31:0] x, y;
+)";
+
+    auto out = std::back_inserter(result);
+    for (size_t i = 0; i < numUses; i++) {
+        fmt::format_to(out,
+                       "    `DECL(`CAT(r, {0}), {1})\n"
+                       "    assign `CAT(r, {0}) = "
+                       "`SAT(`MUX(sel, `ADD(x, {0}), `MUL(y, {1})), {1});\n"
+                       "    localparam string `CAT(s, {0}) = `STR(r_{0});\n",
+                       i, (i % 16) + 8);
+    }
+
+    result += "endmodule\n";
+    return result;
+}
+
+std::string generateNetlist(size_t numCells) {
+    std::string result = R"(
+//////////////////////////////////////////////////////////////////////////////
+//
+//   Generated netlist for top-level design: chip_top
+//   All signal names below are flattened from the original RTL hierarchy.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+module chip_top(input wire clk, input wire rst_n);
+)";
+
+    auto out = std::back_inserter(result);
+    for (size_t i = 0; i < numCells; i++) {
+        if (i % 64 == 0) {
+            fmt::format_to(out, R"(
+    /**************************************************************************
+     * Cell group {0}
+     * Source: u_core/u_datapath/u_alu_cluster_{0}/gen_lanes
+     **************************************************************************/
+)",
+                           i / 64);
+        }
+
+        fmt::format_to(out,
+                       "    wire u_core_u_datapath_u_alu_cluster_{0}_gen_lanes_lane_data_q_{1};\n"
+                       "    (* src = \"rtl/core/datapath/alu_cluster.sv:{2}.{3}-{2}.{4}\" *)\n"
+                       "    sky130_fd_sc_hd__dfrtp_1 u_core_u_datapath_u_alu_cluster_{0}_reg_{1} "
+                       "(.CLK(clk), .RESET_B(rst_n),\n"
+                       "        .D(u_core_u_datapath_u_alu_cluster_{0}_gen_lanes_lane_data_d_{1}),"
+                       "      // next state\n"
+                       "        .Q(u_core_u_datapath_u_alu_cluster_{0}_gen_lanes_lane_data_q_{1}));"
+                       "    // flop {1}\n",
+                       i / 64, i, (i * 7) % 2000 + 1, (i % 40) + 5, (i % 40) + 31);
+    }
+
+    result += "endmodule\n";
+    return result;
+}
+
+std::string generateConstantFunctions() {
+    return R"(
+function automatic int fib(int n);
+    return n <= 1 ? n : fib(n - 1) + fib(n - 2);
+endfunction
+
+function automatic int sieve(int n);
+    bit composite [] = new [n + 1];
+    int count = 0;
+    for (int i = 2; i <= n; i++) begin
+        if (!composite[i]) begin
+            count++;
+            for (int j = i * 2; j <= n; j += i)
+                composite[j] = 1;
+        end
+    end
+    return count;
+endfunction
+
+function automatic logic [127:0] crc(logic [127:0] data, int rounds);
+    logic [127:0] r = data;
+    for (int i = 0; i < rounds; i++)
+        r = {r[126:0], r[127] ^ r[100] ^ r[63] ^ r[1]} ^ (r * 128'd6364136223846793005);
+    return r;
+endfunction
+)";
+}
+
+} // namespace slang::bench
@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace slang::bench {
+
+/// Generates a synthetic design containing @a numModules leaf module definitions,
+/// each instantiated once from a single top-level module. The leaf modules exercise
+/// a representative mix of constructs: parameters, ports, procedural blocks,
+/// generate loops, and functions.
+std::string generateDesign(size_t numModules);
+
+/// Generates a source text that leans heavily on macro definitions and expansions,
+/// including nested macro arguments, with @a numUses expansion sites.
+std::string generateMacroText(size_t numUses);
+
+/// Generates a flattened gate-level style netlist with @a numCells cell instances,
+/// in the style of synthesis tool output: long hierarchical signal names, large
+/// comment banners, and string attributes. Most of the text is trivia, identifiers,
+/// and string contents, which makes it useful for measuring raw lexer throughput.
+std::string generateNetlist(size_t numCells);
+
+/// Generates a package containing a set of recursive and iterative constant functions
+/// that are useful for exercising the constant evaluator.
+std::string generateConstantFunctions();
+
+} // namespace slang::bench
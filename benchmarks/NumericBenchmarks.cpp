@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include <benchmark/benchmark.h>
+#include <random>
+#include <vector>
+
+#include "slang/numeric/SVInt.h"
+
+using namespace slang;
+
+namespace {
+
+// Builds a set of pseudo-random values of the given width. A fixed seed is
+// used so that results are comparable across runs and commits.
+std::vector<SVInt> makeOperands(bitwidth_t width, size_t count) {
+    std::mt19937_64 rng(12345);
+    std::vector<SVInt> results;
+    results.reserve(count);
+
+    std::vector<uint64_t> words((width + 63) / 64);
+    for (size_t i = 0; i < count; i++) {
+        for (auto& word : words)
+            word = rng() | 1;
+        auto bytes = std::as_bytes(std::span(words)).first((width + 7) / 8);
+        results.emplace_back(width, bytes, false);
+    }
+    return results;
+}
+
+template<typename TOp>
+void runBinaryOp(benchmark::State& state, TOp&& op) {
+    constexpr size_t NumOperands = 64;
+    auto operands = makeOperands(bitwidth_t(state.range(0)), NumOperands);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        auto& lhs = operands[i % NumOperands];
+        auto& rhs = operands[(i + 1) % NumOperands];
+        benchmark::DoNotOptimize(op(lhs, rhs));
+        i++;
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+
+} // namespace
+
+static void BM_SVIntAdd(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return a + b; });
+}
+BENCHMARK(BM_SVIntAdd)->Arg(32)->Arg(64)->Arg(128)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntMul(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return a * b; });
+}
+BENCHMARK(BM_SVIntMul)->Arg(32)->Arg(64)->Arg(128)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntDiv(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return a / b; });
+}
+BENCHMARK(BM_SVIntDiv)->Arg(32)->Arg(64)->Arg(128)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntShift(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt&) { return a.shl(17) ^ a.lshr(5); });
+}
+BENCHMARK(BM_SVIntShift)->Arg(32)->Arg(64)->Arg(128)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntCompare(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return a < b; });
+}
+BENCHMARK(BM_SVIntCompare)->Arg(32)->Arg(64)->Arg(128)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntToString(benchmark::State& state) {
+    constexpr size_t NumOperands = 64;
+    auto operands = makeOperands(bitwidth_t(state.range(0)), NumOperands);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        auto& value = operands[i % NumOperands];
+        benchmark::DoNotOptimize(value.toString(LiteralBase::Decimal, false, SVInt::MAX_BITS));
+        i++;
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntToString)->Arg(32)->Arg(128)->Arg(1024)->Arg(8192)->Arg(65536);
+
+// The following run across a wide range of sizes to show where the Karatsuba
+// multiply and recursive division thresholds kick in.
+static void BM_SVIntMulWide(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return a * b; });
+}
+BENCHMARK(BM_SVIntMulWide)->RangeMultiplier(2)->Range(512, 65536);
+
+static void BM_SVIntDivWide(benchmark::State& state) {
+    // Divide 2n-bit values by n-bit values, which gives an n-bit quotient.
+    constexpr size_t NumOperands = 16;
+    auto width = bitwidth_t(state.range(0));
+    auto dividends = makeOperands(width * 2, NumOperands);
+    auto divisors = makeOperands(width, NumOperands);
+    for (auto& divisor : divisors)
+        divisor = divisor.zext(width * 2);
+
+    size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dividends[i % NumOperands] / divisors[(i + 1) % NumOperands]);
+        i++;
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntDivWide)->RangeMultiplier(2)->Range(512, 65536);
+
+static void BM_SVIntBitwise(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt& b) { return (a & b) ^ (a | b); });
+}
+BENCHMARK(BM_SVIntBitwise)->Arg(32)->Arg(64)->Arg(512)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntSlice(benchmark::State& state) {
+    runBinaryOp(state, [](const SVInt& a, const SVInt&) {
+        auto width = int32_t(a.getBitWidth());
+        return a.slice(width - 1, width / 2);
+    });
+}
+BENCHMARK(BM_SVIntSlice)->Arg(32)->Arg(64)->Arg(512)->Arg(1024)->Arg(8192);
+
+static void BM_SVIntFourStateMerge(benchmark::State& state) {
+    // Mix in some unknown bits so that the four-state paths are exercised.
+    constexpr size_t NumOperands = 64;
+    auto width = bitwidth_t(state.range(0));
+    auto operands = makeOperands(width, NumOperands);
+    for (size_t i = 0; i < NumOperands; i += 2)
+        operands[i].set(int32_t(width / 2), int32_t(width / 4),
+                        SVInt::createFillX(width / 4 + 1, false));
+
+    SVInt cond(logic_t::x);
+    size_t i = 0;
+    for (auto _ : state) {
+        auto& lhs = operands[i % NumOperands];
+        auto& rhs = operands[(i + 1) % NumOperands];
+        benchmark::DoNotOptimize(SVInt::conditional(cond, lhs, rhs));
+        benchmark::DoNotOptimize(lhs & rhs);
+        benchmark::DoNotOptimize(lhs | rhs);
+        i++;
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()));
+}
+BENCHMARK(BM_SVIntFourStateMerge)->Arg(64)->Arg(512)->Arg(1024)->Arg(8192);
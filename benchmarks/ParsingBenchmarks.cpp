@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "DesignGenerator.h"
+#include <benchmark/benchmark.h>
+
+#include "slang/diagnostics/Diagnostics.h"
+#include "slang/parsing/Lexer.h"
+#include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/SyntaxTree.h"
+#include "slang/text/SourceManager.h"
+#include "slang/util/BumpAllocator.h"
+
+using namespace slang;
+using namespace slang::parsing;
+using namespace slang::syntax;
+
+static void BM_Lexer(benchmark::State& state, std::string (*generate)(size_t)) {
+    auto text = generate(size_t(state.range(0)));
+    SourceManager sourceManager;
+    auto buffer = sourceManager.assignText(text);
+
+    int64_t tokenCount = 0;
+    for (auto _ : state) {
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Lexer lexer(buffer, alloc, diagnostics);
+
+        while (true) {
+            auto token = lexer.lex();
+            tokenCount++;
+            if (token.kind == TokenKind::EndOfFile)
+                break;
+        }
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+    state.counters["tokens"] = benchmark::Counter(double(tokenCount),
+                                                  benchmark::Counter::kIsRate);
+}
+BENCHMARK_CAPTURE(BM_Lexer, design, bench::generateDesign)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_Lexer, netlist, bench::generateNetlist)
+    ->RangeMultiplier(8)
+    ->Range(512, 32768)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_MacroExpansion(benchmark::State& state) {
+    auto text = bench::generateMacroText(size_t(state.range(0)));
+
+    int64_t tokenCount = 0;
+    for (auto _ : state) {
+        // Macro expansions add location buffers to the source manager, so each
+        // iteration needs a fresh one to keep them from piling up.
+        state.PauseTiming();
+        SourceManager sourceManager;
+        auto buffer = sourceManager.assignText(text);
+        state.ResumeTiming();
+
+        BumpAllocator alloc;
+        Diagnostics diagnostics;
+        Preprocessor preprocessor(sourceManager, alloc, diagnostics);
+        preprocessor.pushSource(buffer);
+
+        while (true) {
+            auto token = preprocessor.next();
+            tokenCount++;
+            if (token.kind == TokenKind::EndOfFile)
+                break;
+        }
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+    state.counters["tokens"] = benchmark::Counter(double(tokenCount),
+                                                  benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_MacroExpansion)->RangeMultiplier(4)->Range(16, 4096)->Unit(benchmark::kMillisecond);
+
+static void BM_Parser(benchmark::State& state) {
+    auto text = bench::generateDesign(size_t(state.range(0)));
+
+    for (auto _ : state) {
+        SourceManager sourceManager;
+        auto tree = SyntaxTree::fromText(text, sourceManager);
+        benchmark::DoNotOptimize(tree->root());
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) * int64_t(text.size()));
+}
+BENCHMARK(BM_Parser)->RangeMultiplier(4)->Range(16, 1024)->Unit(benchmark::kMillisecond);
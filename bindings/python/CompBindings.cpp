@@ -56,7 +56,10 @@ void registerCompilation(py::module_& m) {
         .value("AllowBareValParamAssignment", CompilationFlags::AllowBareValParamAssignment)
         .value("AllowSelfDeterminedStreamConcat", CompilationFlags::AllowSelfDeterminedStreamConcat)
         .value("AllowMultiDrivenLocals", CompilationFlags::AllowMultiDrivenLocals)
-        .value("AllowMergingAnsiPorts", CompilationFlags::AllowMergingAnsiPorts);
+        .value("AllowMergingAnsiPorts", CompilationFlags::AllowMergingAnsiPorts)
+        .value("EnableInstanceCaching", CompilationFlags::EnableInstanceCaching)
+        .value("ConstexprBytecode", CompilationFlags::ConstexprBytecode)
+        .value("HierarchyOnly", CompilationFlags::HierarchyOnly);
 
     py::class_<CompilationOptions>(m, "CompilationOptions")
         .def(py::init<>())
@@ -66,6 +69,7 @@ void registerCompilation(py::module_& m) {
         .def_readwrite("maxConstexprDepth", &CompilationOptions::maxConstexprDepth)
         .def_readwrite("maxConstexprSteps", &CompilationOptions::maxConstexprSteps)
         .def_readwrite("maxConstexprBacktrace", &CompilationOptions::maxConstexprBacktrace)
+        .def_readwrite("maxConstexprMemo", &CompilationOptions::maxConstexprMemo)
         .def_readwrite("maxDefParamSteps", &CompilationOptions::maxDefParamSteps)
         .def_readwrite("maxInstanceArray", &CompilationOptions::maxInstanceArray)
         .def_readwrite("errorLimit", &CompilationOptions::errorLimit)
@@ -109,6 +113,7 @@ void registerCompilation(py::module_& m) {
         .def("getStdPackage", &Compilation::getStdPackage, byrefint)
         .def("getPackages", &Compilation::getPackages, byrefint)
         .def("getGateType", &Compilation::getGateType, byrefint, "name"_a)
+        .def("getAllocatorStats", &Compilation::getAllocatorStats)
         .def("getAttributes",
              py::overload_cast<const Symbol&>(&Compilation::getAttributes, py::const_), byrefint,
              "symbol"_a)
@@ -413,6 +413,7 @@ void registerSymbols(py::module_& m) {
         .def_property_readonly("isInterface", &InstanceSymbol::isInterface)
         .def_property_readonly("portConnections", &InstanceSymbol::getPortConnections)
         .def_property_readonly("body", [](const InstanceSymbol& self) { return &self.body; })
+        .def_property_readonly("canonicalBody", &InstanceSymbol::getCanonicalBody)
         .def("getPortConnection",
              py::overload_cast<const PortSymbol&>(&InstanceSymbol::getPortConnection, py::const_),
              byrefint, "port"_a)
@@ -431,6 +432,11 @@ void registerSymbols(py::module_& m) {
         .def_property_readonly("portList", &InstanceBodySymbol::getPortList)
         .def_property_readonly("definition", &InstanceBodySymbol::getDefinition)
         .def("findPort", &InstanceBodySymbol::findPort, byrefint, "portName"_a)
+        .def_property_readonly("hasHierarchicalReferences",
+                               &InstanceBodySymbol::hasHierarchicalReferences)
+        .def_property_readonly("isHierarchicalReferenceTarget",
+                               &InstanceBodySymbol::isHierarchicalReferenceTarget)
+        .def_property_readonly("numSharedInstances", &InstanceBodySymbol::getNumSharedInstances)
         .def("hasSameType", &InstanceBodySymbol::hasSameType, "other"_a);
 
     py::class_<InstanceArraySymbol, Symbol, Scope>(m, "InstanceArraySymbol")
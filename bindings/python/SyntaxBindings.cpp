@@ -263,6 +263,7 @@ void registerSyntax(py::module_& m) {
         .def_property_readonly("root", py::overload_cast<>(&SyntaxTree::root))
         .def_property_readonly("options", &SyntaxTree::options)
         .def_property_readonly("sourceLibrary", &SyntaxTree::getSourceLibrary)
+        .def("getAllocatorStats", &SyntaxTree::getAllocatorStats)
         .def_static("getDefaultSourceManager", &SyntaxTree::getDefaultSourceManager, byref);
 
     py::class_<LexerOptions>(m, "LexerOptions")
@@ -278,7 +279,26 @@ void registerSyntax(py::module_& m) {
         .def_readwrite("predefines", &PreprocessorOptions::predefines)
         .def_readwrite("undefines", &PreprocessorOptions::undefines)
         .def_readwrite("additionalIncludePaths", &PreprocessorOptions::additionalIncludePaths)
-        .def_readwrite("ignoreDirectives", &PreprocessorOptions::ignoreDirectives);
+        .def_readwrite("ignoreDirectives", &PreprocessorOptions::ignoreDirectives)
+        .def_property(
+            "snapshot",
+            [](const PreprocessorOptions& self) {
+                return std::const_pointer_cast<PreprocessorSnapshot>(self.snapshot);
+            },
+            [](PreprocessorOptions& self, std::shared_ptr<PreprocessorSnapshot> snapshot) {
+                self.snapshot = std::move(snapshot);
+            });
+
+    py::class_<PreprocessorSnapshot, std::shared_ptr<PreprocessorSnapshot>>(m,
+                                                                            "PreprocessorSnapshot")
+        .def_readonly("macros", &PreprocessorSnapshot::macros)
+        .def_readonly("includeOnceHeaders", &PreprocessorSnapshot::includeOnceHeaders)
+        .def_readonly("includeGuards", &PreprocessorSnapshot::includeGuards)
+        .def_static("fromBuffers", &PreprocessorSnapshot::fromBuffers, "sourceManager"_a,
+                    "buffers"_a, "diagnostics"_a, "options"_a = Bag())
+        .def_static("deserialize", &PreprocessorSnapshot::deserialize, "sourceManager"_a,
+                    "buffer"_a, "diagnostics"_a, "options"_a = Bag())
+        .def("serialize", &PreprocessorSnapshot::serialize);
 
     py::class_<ParserOptions>(m, "ParserOptions")
         .def(py::init<>())
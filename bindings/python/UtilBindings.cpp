@@ -23,7 +23,25 @@
 namespace fs = std::filesystem;
 
 void registerUtil(py::module_& m) {
-    py::class_<BumpAllocator>(m, "BumpAllocator").def(py::init<>());
+    py::class_<BumpAllocatorOptions>(m, "BumpAllocatorOptions")
+        .def(py::init<>())
+        .def_readwrite("segmentSize", &BumpAllocatorOptions::segmentSize)
+        .def_readwrite("segmentsPerDoubling", &BumpAllocatorOptions::segmentsPerDoubling)
+        .def_readwrite("maxSegmentSize", &BumpAllocatorOptions::maxSegmentSize)
+        .def_readwrite("useHugePages", &BumpAllocatorOptions::useHugePages);
+
+    py::class_<BumpAllocatorStats>(m, "BumpAllocatorStats")
+        .def(py::init<>())
+        .def_readonly("bytesUsed", &BumpAllocatorStats::bytesUsed)
+        .def_readonly("bytesReserved", &BumpAllocatorStats::bytesReserved)
+        .def_readonly("segmentCount", &BumpAllocatorStats::segmentCount)
+        .def_property_readonly("wastedBytes", &BumpAllocatorStats::wastedBytes);
+
+    py::class_<BumpAllocator>(m, "BumpAllocator")
+        .def(py::init<>())
+        .def(py::init<const BumpAllocatorOptions&>(), "options"_a)
+        .def_property_readonly("options", &BumpAllocator::getOptions)
+        .def("getStats", &BumpAllocator::getStats);
 
     py::class_<Bag>(m, "Bag")
         .def(py::init<>())
@@ -39,6 +57,8 @@ void registerUtil(py::module_& m) {
                          result.set(item.cast<ParserOptions>());
                      else if (type.is(py::type::of<CompilationOptions>()))
                          result.set(item.cast<CompilationOptions>());
+                     else if (type.is(py::type::of<BumpAllocatorOptions>()))
+                         result.set(item.cast<BumpAllocatorOptions>());
                      else
                          throw py::type_error();
                  }
@@ -52,7 +72,10 @@ void registerUtil(py::module_& m) {
         .def_property("parserOptions", &Bag::get<ParserOptions>,
                       py::overload_cast<const ParserOptions&>(&Bag::set<ParserOptions>))
         .def_property("compilationOptions", &Bag::get<CompilationOptions>,
-                      py::overload_cast<const CompilationOptions&>(&Bag::set<CompilationOptions>));
+                      py::overload_cast<const CompilationOptions&>(&Bag::set<CompilationOptions>))
+        .def_property(
+            "allocatorOptions", &Bag::get<BumpAllocatorOptions>,
+            py::overload_cast<const BumpAllocatorOptions&>(&Bag::set<BumpAllocatorOptions>));
 
     py::class_<BufferID>(m, "BufferID")
         .def(py::init<>())
@@ -171,6 +194,7 @@ void registerUtil(py::module_& m) {
             "path"_a, "includedFrom"_a, "library"_a, "isSystemPath"_a)
         .def("isCached", &SourceManager::isCached, "path"_a)
         .def("setDisableProximatePaths", &SourceManager::setDisableProximatePaths, "set"_a)
+        .def("setMemoryMapFiles", &SourceManager::setMemoryMapFiles, "set"_a)
         .def("addLineDirective", &SourceManager::addLineDirective, "location"_a, "lineNum"_a,
              "name"_a, "level"_a)
         .def("addDiagnosticDirective", &SourceManager::addDiagnosticDirective, "location"_a,
@@ -8,6 +8,8 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
+#include <thread>
 
 #include "slang/ast/OpaqueInstancePath.h"
 #include "slang/ast/Scope.h"
@@ -129,9 +131,24 @@ enum class SLANG_EXPORT CompilationFlags {
 
     /// Allow merging ANSI port declarations with nets and variables
     /// declared in the module body.
-    AllowMergingAnsiPorts = 1 << 14
+    AllowMergingAnsiPorts = 1 << 14,
+
+    /// Share elaboration work between instances that have identical definitions
+    /// and parameter values, so that only one of them is fully elaborated. Bodies
+    /// are still created for every instance; only the work of binding and checking
+    /// their contents is shared.
+    EnableInstanceCaching = 1 << 15,
+
+    /// Lower constant functions to a register-based bytecode the first time they
+    /// are evaluated and run that instead of walking the AST on every call.
+    ConstexprBytecode = 1 << 16,
+
+    /// Only elaborate the instance hierarchy and parameter values. Statements,
+    /// expressions, and other members of instance bodies are not bound during
+    /// elaboration, so diagnostics within them will not be reported.
+    HierarchyOnly = 1 << 17
 };
-SLANG_BITMASK(CompilationFlags, AllowMergingAnsiPorts)
+SLANG_BITMASK(CompilationFlags, HierarchyOnly)
 
 /// Contains various options that can control compilation behavior.
 struct SLANG_EXPORT CompilationOptions {
@@ -162,6 +179,11 @@ struct SLANG_EXPORT CompilationOptions {
     /// before abbreviating them.
     uint32_t maxConstexprBacktrace = 10;
 
+    /// The maximum number of results of calls to pure constant functions to
+    /// remember, so that repeated calls with the same arguments don't need to be
+    /// evaluated again. Setting this to zero (the default) disables memoization.
+    uint32_t maxConstexprMemo = 0;
+
     /// The maximum number of iterations to try to resolve defparams before
     /// giving up due to potentially cyclic dependencies in parameter values.
     uint32_t maxDefParamSteps = 128;
@@ -267,6 +289,10 @@ struct SLANG_EXPORT HierarchyOverrideNode {
 /// retrieve the root of the elaborated AST, and getAllDiagnostics() to get
 /// a list of all diagnostics issued in the design.
 ///
+/// Elaboration is single threaded, and a compilation may only be used from the
+/// thread that created it, with the exception of getThreadAllocator(), which
+/// gives other threads an allocator whose memory lives as long as the compilation.
+///
 class SLANG_EXPORT Compilation : public BumpAllocator {
 public:
     /// Constructs a new instance of the Compilation class.
@@ -580,6 +606,47 @@ public:
     /// be elaborated and any relevant diagnostics to be issued.
     void forceElaborate(const Symbol& symbol);
 
+    /// Identifies a call to a pure constant function: the subroutine being
+    /// called, the evaluation flags that can affect its result, and its
+    /// argument values packed into an unpacked array.
+    using ConstantCallKey = std::tuple<const SubroutineSymbol*, uint8_t, ConstantValue>;
+
+    /// The memoized result of a call to a pure constant function.
+    struct MemoizedCall {
+        /// The value returned by the call.
+        ConstantValue result;
+
+        /// The number of evaluation steps the call took, which is charged
+        /// against the step limit each time the result is reused.
+        uint32_t steps = 0;
+    };
+
+    /// Statistics about memoization of pure constant function calls.
+    struct ConstantMemoStats {
+        /// The number of calls whose result was found in the memo table.
+        uint64_t hits = 0;
+
+        /// The number of calls whose result had to be computed.
+        uint64_t misses = 0;
+
+        /// The number of results currently held in the memo table.
+        size_t entries = 0;
+    };
+
+    /// Looks up the result of a previous call to a pure constant function with the
+    /// same arguments. Returns std::nullopt if no such call has been memoized.
+    /// This is safe to call from any thread.
+    std::optional<MemoizedCall> findMemoizedCall(const ConstantCallKey& key);
+
+    /// Records the result of a call to a pure constant function so that it can be
+    /// reused for later calls with the same arguments. Does nothing once the memo
+    /// table has reached the size given by @a CompilationOptions::maxConstexprMemo.
+    /// This is safe to call from any thread.
+    void memoizeCall(ConstantCallKey&& key, MemoizedCall&& call);
+
+    /// Gets statistics about memoization of pure constant function calls.
+    ConstantMemoStats getConstantMemoStats() const;
+
     /// Gets the default time scale to use when none is specified in the source code.
     std::optional<TimeScale> getDefaultTimeScale() const { return options.defaultTimeScale; }
 
@@ -671,6 +738,18 @@ public:
     /// @name Allocation functions
     /// @{
 
+    /// Gets an allocator for the calling thread. The compilation itself, and
+    /// everything that allocates from it, may only be used from the thread that
+    /// created it; other threads need to allocate from this instead, for example
+    /// when passing an allocator to SmallVector::copy. Each thread gets its own
+    /// arena, the memory of which lives as long as the compilation.
+    /// This is safe to call from any thread.
+    BumpAllocator& getThreadAllocator() {
+        if (std::this_thread::get_id() == ownerThread)
+            return *this;
+        return getThreadArena();
+    }
+
     /// Allocates space for a constant value in the pool of constants.
     ConstantValue* allocConstant(ConstantValue&& value) {
         return constantAllocator.emplace(std::move(value));
@@ -705,6 +784,11 @@ public:
         return unrollIntervalMapAllocator;
     }
 
+    /// Gets statistics about the memory held by the compilation's allocators,
+    /// including the arenas of any other threads that have allocated from it.
+    /// This does not include memory owned by syntax trees added to the compilation.
+    BumpAllocatorStats getAllocatorStats() const;
+
     /// Creates an empty ImplicitTypeSyntax object.
     const syntax::ImplicitTypeSyntax& createEmptyTypeSyntax(SourceLocation loc);
 
@@ -818,6 +902,13 @@ private:
     flat_hash_map<std::tuple<std::string_view, SymbolKind>, std::shared_ptr<SystemSubroutine>>
         methodMap;
 
+    // Memoized results of calls to pure constant functions.
+    // Guarded by constantMemoMutex, since constant evaluation can happen on worker threads.
+    flat_hash_map<ConstantCallKey, MemoizedCall> constantMemo;
+    uint64_t constantMemoHits = 0;
+    uint64_t constantMemoMisses = 0;
+    mutable std::mutex constantMemoMutex;
+
     // Map from pointers (to symbols, statements, expressions) to their associated attributes.
     flat_hash_map<const void*, std::span<const AttributeSymbol* const>> attributeMap;
 
@@ -867,6 +958,20 @@ private:
     TypedBumpAllocator<ConfigBlockSymbol> configBlockAllocator;
     TypedBumpAllocator<Scope::WildcardImportData> wildcardImportAllocator;
 
+    BumpAllocator& getThreadArena();
+
+    // The thread that created the compilation; all other threads that ask for
+    // an allocator are given an arena of their own.
+    std::thread::id ownerThread = std::this_thread::get_id();
+
+    // A process-unique ID for the compilation, used to validate the
+    // per-thread cache of the most recently used arena.
+    uint64_t compilationId;
+
+    // Arenas for each thread that has allocated from the compilation.
+    mutable std::mutex threadArenaMutex;
+    std::vector<std::pair<std::thread::id, std::unique_ptr<BumpAllocator>>> threadArenas;
+
     // This is storage for a temporary diagnostic that is being constructed.
     // Typically this is done in-place within the diagMap, but for diagnostics
     // that have been supressed we need space to return *something* to the caller.
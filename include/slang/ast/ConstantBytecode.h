@@ -0,0 +1,168 @@
+//------------------------------------------------------------------------------
+//! @file ConstantBytecode.h
+//! @brief Bytecode form of constant functions
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <span>
+
+#include "slang/ast/Statements.h"
+#include "slang/numeric/ConstantValue.h"
+
+namespace slang::ast {
+
+class EvalContext;
+class Expression;
+class SubroutineSymbol;
+class ValueSymbol;
+
+/// @brief A constant function body lowered to a register-based instruction stream.
+///
+/// Function locals are resolved to register slots once per call instead of being
+/// looked up by symbol every time they are referenced, and control flow is flattened
+/// into jumps. Statements and expressions that the compiler doesn't handle natively
+/// are embedded as instructions that defer to the normal tree-walking evaluator,
+/// so any function body can be compiled as long as it doesn't use disable statements.
+///
+/// Step counting matches the tree walker exactly, so the same limits and diagnostics
+/// apply regardless of which form gets evaluated.
+class SLANG_EXPORT ConstantBytecode {
+public:
+    /// The set of supported operations.
+    enum class Opcode : uint8_t {
+        /// Counts a statement step at the location of @a stmt.
+        Step,
+
+        /// dst = *constant
+        LoadConst,
+
+        /// dst = src (src is moved from if it is a temporary)
+        Move,
+
+        /// Looks up the storage for @a symbol in the current frame and binds it to
+        /// local slot @a dst.
+        BindLocal,
+
+        /// Creates storage for the variable declared by @a stmt, initialized from
+        /// register a (or defaulted if a is NoReg), and binds it to local slot @a dst.
+        DeclLocal,
+
+        /// dst = expr->eval()
+        EvalExpr,
+
+        /// Evaluates @a stmt with the tree walker; a and b hold the jump
+        /// targets for break and continue results.
+        EvalStmt,
+
+        /// dst = op a
+        Unary,
+
+        /// Increments or decrements integer local slot a in place.
+        /// The result is written to dst if it's not NoReg.
+        IncDec,
+
+        /// dst = a op b
+        Binary,
+
+        /// Short circuits a logical operator; if register a decides the result
+        /// it's written to dst and execution jumps to b.
+        ShortCircuit,
+
+        /// dst = convert(a) using the conversion expression @a expr
+        Convert,
+
+        /// Jumps to a.
+        Jump,
+
+        /// Jumps to b if register a is not true.
+        JumpIfFalse,
+
+        /// Jumps to b if register a is false and to c if it has unknown bits.
+        Branch,
+
+        /// Merges registers b and c with mask a as in a conditional
+        /// operator with an unknown predicate.
+        MergeCond,
+
+        /// Validates the repeat count in register a and stores it in counter dst.
+        RepeatInit,
+
+        /// Decrements counter dst, jumping to a if it was already exhausted.
+        RepeatNext,
+
+        /// Pushes local slot a onto the context's lvalue stack.
+        PushLValue,
+
+        /// Pops the lvalue pushed by the matching PushLValue.
+        PopLValue,
+
+        /// Exits the function with a return result.
+        Return,
+
+        /// Exits the function normally.
+        Exit
+    };
+
+    /// A single operation in the instruction stream.
+    struct Instruction {
+        /// The operation to perform.
+        Opcode op;
+
+        /// An operator for Unary, IncDec, Binary, and ShortCircuit instructions.
+        uint8_t subOp = 0;
+
+        /// The destination register.
+        uint32_t dst = 0;
+
+        /// The first operand register or jump target.
+        uint32_t a = 0;
+
+        /// The second operand register or jump target.
+        uint32_t b = 0;
+
+        /// The third operand register or jump target.
+        uint32_t c = 0;
+
+        union {
+            const Expression* expr = nullptr;
+            const Statement* stmt;
+            const ConstantValue* constant;
+            const ValueSymbol* symbol;
+        };
+    };
+
+    /// Register operands with this bit set refer to local variable slots;
+    /// the rest refer to temporaries.
+    static constexpr uint32_t LocalBit = 1u << 31;
+
+    /// A register index that indicates the absence of an operand.
+    static constexpr uint32_t NoReg = UINT32_MAX;
+
+    /// The instructions that make up the program.
+    std::span<const Instruction> instructions;
+
+    /// The number of local variable slots used by the program.
+    uint32_t numLocals = 0;
+
+    /// The number of temporary registers used by the program.
+    uint32_t numTemps = 0;
+
+    /// The number of repeat loop counters used by the program.
+    uint32_t numCounters = 0;
+
+    /// The maximum number of lvalues the program pushes at once.
+    uint32_t numLValues = 0;
+
+    /// Compiles the body of the given subroutine. Returns nullptr if the body
+    /// is something that can't be represented.
+    static const ConstantBytecode* compile(const SubroutineSymbol& subroutine);
+
+    /// Runs the program in the current frame of @a context, which must already have
+    /// been set up with the subroutine's arguments and return value storage.
+    Statement::EvalResult run(EvalContext& context) const;
+};
+
+} // namespace slang::ast
@@ -97,6 +97,14 @@ public:
     /// a single constant function for too long.
     [[nodiscard]] bool step(SourceLocation loc);
 
+    /// Gets the number of statements executed so far.
+    uint32_t getSteps() const { return steps; }
+
+    /// Records the fact that @a count statements have been executed at once, such
+    /// as when reusing the memoized result of a function call. If that would exceed
+    /// the step limit nothing is recorded and false is returned.
+    [[nodiscard]] bool tryAddSteps(uint32_t count);
+
     /// Returns true if the context is currently within a function call, and false if
     /// this is a top-level expression.
     bool inFunction() const { return !stack.empty(); }
@@ -161,6 +169,9 @@ public:
     /// Gets the set of diagnostics that have been produced during constant evaluation.
     Diagnostics getAllDiagnostics() const;
 
+    /// Gets the number of diagnostics, including warnings, recorded so far.
+    size_t getDiagCount() const { return diags.size() + warnings.size(); }
+
     /// Records a diagnostic under the current evaluation context.
     Diagnostic& addDiag(DiagCode code, SourceLocation location);
 
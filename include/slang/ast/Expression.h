@@ -358,6 +358,15 @@ public:
     /// target operand. Otherwise returns `*this`.
     const Expression& unwrapImplicitConversions() const;
 
+    /// Applies the given (non-lvalue) unary operator to an already evaluated operand.
+    /// Returns an invalid value if the operand is invalid.
+    static ConstantValue evalUnaryOperator(UnaryOperator op, ConstantValue&& cv);
+
+    /// Applies the given binary operator to already evaluated operands.
+    /// Returns an invalid value if either operand is invalid.
+    static ConstantValue evalBinaryOperator(BinaryOperator op, const ConstantValue& cvl,
+                                            const ConstantValue& cvr);
+
     /// @brief Casts this expression to the given concrete derived type.
     ///
     /// Asserts that the type is appropriate given this expression's kind.
@@ -414,9 +423,6 @@ protected:
     static const Type* binaryOperatorType(Compilation& compilation, const Type* lt, const Type* rt,
                                           bool forceFourState, bool signednessFromRt = false);
 
-    static ConstantValue evalBinaryOperator(BinaryOperator op, const ConstantValue& cvl,
-                                            const ConstantValue& cvr);
-
     static Expression& create(Compilation& compilation, const ExpressionSyntax& syntax,
                               const ASTContext& context,
                               bitmask<ASTFlags> extraFlags = ASTFlags::None,
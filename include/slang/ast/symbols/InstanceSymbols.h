@@ -99,6 +99,16 @@ public:
     bool isInterface() const;
     bool isTopLevel() const;
 
+    /// If elaboration of this instance was shared with another instance that has an
+    /// identical definition and parameter values, returns the body of that other
+    /// instance, which holds the elaborated results. Otherwise returns nullptr.
+    /// The instance's own body remains available for hierarchy traversal.
+    const InstanceBodySymbol* getCanonicalBody() const { return canonicalBody; }
+
+    /// Marks this instance as sharing elaboration results with the given body,
+    /// or clears the sharing if @a canonical is nullptr.
+    void setCanonicalBody(const InstanceBodySymbol* canonical) const { canonicalBody = canonical; }
+
     const PortConnection* getPortConnection(const PortSymbol& port) const;
     const PortConnection* getPortConnection(const MultiPortSymbol& port) const;
     const PortConnection* getPortConnection(const InterfacePortSymbol& port) const;
@@ -150,6 +160,7 @@ private:
 
     mutable PointerMap* connectionMap = nullptr;
     mutable std::span<const PortConnection* const> connections;
+    mutable const InstanceBodySymbol* canonicalBody = nullptr;
 };
 
 class SLANG_EXPORT InstanceBodySymbol : public Symbol, public Scope {
@@ -184,6 +195,42 @@ public:
 
     bool hasSameType(const InstanceBodySymbol& other) const;
 
+    /// Notes that a hierarchical reference was resolved from within this body.
+    /// The note is propagated to all parent instance bodies as well.
+    void noteHierarchicalReference() const;
+
+    /// Notes that a hierarchical reference resolved to a symbol within this body.
+    /// The note is propagated to all parent instance bodies as well.
+    void noteHierarchicalReferenceTarget() const;
+
+    /// Notes that something within this body drives a symbol declared outside of it,
+    /// such as a package or $unit variable. The note is propagated to all parent
+    /// instance bodies as well.
+    void noteExternalDriver() const;
+
+    /// Indicates whether a hierarchical reference has been resolved from within
+    /// this body or any of its child instances. Such bodies cannot share their
+    /// elaboration results with other instances.
+    bool hasHierarchicalReferences() const { return hasHierRefs; }
+
+    /// Indicates whether a hierarchical reference elsewhere in the design resolved
+    /// to a symbol within this body or any of its child instances. Such bodies must
+    /// be elaborated separately so that all drivers of the target are known.
+    bool isHierarchicalReferenceTarget() const { return isHierRefTarget; }
+
+    /// Indicates whether this body or any of its child instances drives a symbol
+    /// declared outside of it. Such bodies cannot share their elaboration results
+    /// with other instances, since each instance adds its own drivers.
+    bool hasExternalDrivers() const { return hasExtDrivers; }
+
+    /// Gets the number of other instances in the design that share the elaboration
+    /// results of this body instead of being elaborated separately. This includes
+    /// instances that share it indirectly because one of their parents is shared.
+    size_t getNumSharedInstances() const { return numSharedInstances; }
+
+    /// Sets the number of other instances that share the elaboration results of this body.
+    void setNumSharedInstances(size_t count) const { numSharedInstances = count; }
+
     static InstanceBodySymbol& fromDefinition(
         Compilation& compilation, const DefinitionSymbol& definition, SourceLocation instanceLoc,
         bitmask<InstanceFlags> flags, const HierarchyOverrideNode* hierarchyOverrideNode,
@@ -207,6 +254,10 @@ private:
     const DefinitionSymbol& definition;
     mutable std::span<const Symbol* const> portList;
     std::span<const ParameterSymbolBase* const> parameters;
+    mutable size_t numSharedInstances = 0;
+    mutable bool hasHierRefs = false;
+    mutable bool isHierRefTarget = false;
+    mutable bool hasExtDrivers = false;
 };
 
 class SLANG_EXPORT InstanceArraySymbol : public Symbol, public Scope {
@@ -14,6 +14,7 @@
 
 namespace slang::ast {
 
+class ConstantBytecode;
 class FormalArgumentSymbol;
 
 /// Specifies various flags that can apply to subroutines.
@@ -122,6 +123,17 @@ public:
     const Statement& getBody() const;
     const Type& getReturnType() const { return declaredReturnType.getType(); }
 
+    /// Gets the body of the subroutine compiled to bytecode for constant evaluation,
+    /// compiling it on first use. Returns nullptr if the body can't be compiled.
+    const ConstantBytecode* getConstantBytecode() const;
+
+    /// Indicates whether the result of calling this subroutine in a constant expression
+    /// depends only on the values of its arguments, which means it can be memoized.
+    /// This is true for functions with only input arguments that reference nothing
+    /// other than their own locals and constants, and that only call system functions
+    /// and other memoizable subroutines.
+    bool isMemoizable() const;
+
     void setOverride(const SubroutineSymbol& parentMethod) const;
     const SubroutineSymbol* getOverride() const { return overrides; }
 
@@ -183,6 +195,8 @@ private:
     mutable const SubroutineSymbol* overrides = nullptr;
     mutable const MethodPrototypeSymbol* prototype = nullptr;
     mutable std::optional<bool> cachedHasOutputArgs;
+    mutable std::optional<const ConstantBytecode*> bytecode;
+    mutable std::optional<bool> cachedIsMemoizable;
     mutable bool isConstructing = false;
 };
 
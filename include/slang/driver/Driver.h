@@ -21,6 +21,10 @@ namespace slang {
 class TextDiagnosticClient;
 }
 
+namespace slang::parsing {
+class PreprocessorSnapshot;
+}
+
 namespace slang::syntax {
 class SyntaxTree;
 }
@@ -102,6 +106,18 @@ public:
         /// A set of preprocessor directives to be ignored.
         std::vector<std::string> ignoreDirectives;
 
+        /// A list of headers to preprocess once up front; the resulting macros
+        /// and `pragma once state are restored at the start of each compilation unit.
+        std::vector<std::string> prefixHeaders;
+
+        /// A preprocessor snapshot file, previously written via @a savePPSnapshot,
+        /// to restore at the start of each compilation unit.
+        std::optional<std::string> loadPPSnapshot;
+
+        /// A file to which the preprocessor snapshot built from @a prefixHeaders
+        /// should be written.
+        std::optional<std::string> savePPSnapshot;
+
         /// @}
         /// @name Parsing
         /// @{
@@ -139,6 +155,9 @@ public:
         /// before abbreviating them.
         std::optional<uint32_t> maxConstexprBacktrace;
 
+        /// The maximum number of results of calls to pure constant functions to remember.
+        std::optional<uint32_t> maxConstexprMemo;
+
         /// The maximum number of instances allowed in a single instance array.
         std::optional<uint32_t> maxInstanceArray;
 
@@ -219,6 +238,14 @@ public:
         /// A set of extensions that will be used to exclude files.
         flat_hash_set<std::string> excludeExts;
 
+        /// If set to true, source files will be memory mapped instead of
+        /// being copied into memory when loaded.
+        std::optional<bool> memoryMapFiles;
+
+        /// If set to true, large allocator segments used for syntax trees and
+        /// compilations will be backed by huge pages where the OS supports it.
+        std::optional<bool> hugePages;
+
         /// @}
 
         /// Returns true if the lintMode option is provided.
@@ -315,10 +342,13 @@ private:
     void addParseOptions(Bag& bag) const;
     void addCompilationOptions(Bag& bag) const;
     bool reportLoadErrors();
+    bool preparePPSnapshot();
     void printError(const std::string& message);
     void printWarning(const std::string& message);
 
     bool anyFailedLoads = false;
+    std::shared_ptr<const parsing::PreprocessorSnapshot> ppSnapshot;
+    Diagnostics ppSnapshotDiags;
     flat_hash_set<std::filesystem::path> activeCommandFiles;
 };
 
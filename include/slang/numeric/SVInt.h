@@ -322,15 +322,30 @@ public:
 
     /// Left shifting.
     [[nodiscard]] SVInt shl(const SVInt& rhs) const;
-    [[nodiscard]] SVInt shl(bitwidth_t amount) const;
+    [[nodiscard]] SVInt shl(bitwidth_t amount) const {
+        if (isSingleWord() && amount < bitWidth)
+            return fromWord(bitWidth, val << amount, signFlag);
+        return shlSlowCase(amount);
+    }
 
     /// Arithmetic right shifting.
     [[nodiscard]] SVInt ashr(const SVInt& rhs) const;
-    [[nodiscard]] SVInt ashr(bitwidth_t amount) const;
+    [[nodiscard]] SVInt ashr(bitwidth_t amount) const {
+        if (isSingleWord() && amount < bitWidth) {
+            if (!signFlag)
+                return fromWord(bitWidth, val >> amount, false);
+            return fromWord(bitWidth, uint64_t(signExtendedWord() >> amount), true);
+        }
+        return ashrSlowCase(amount);
+    }
 
     /// Logical right shifting.
     [[nodiscard]] SVInt lshr(const SVInt& rhs) const;
-    [[nodiscard]] SVInt lshr(bitwidth_t amount) const;
+    [[nodiscard]] SVInt lshr(bitwidth_t amount) const {
+        if (isSingleWord() && amount < bitWidth)
+            return fromWord(bitWidth, val >> amount, signFlag);
+        return lshrSlowCase(amount);
+    }
 
     /// Multiple concatenation/replication
     [[nodiscard]] SVInt replicate(const SVInt& times) const;
@@ -385,7 +400,11 @@ public:
     bitwidth_t countZs() const;
 
     /// Return a subset of the integer's bit range as a new integer.
-    [[nodiscard]] SVInt slice(int32_t msb, int32_t lsb) const;
+    [[nodiscard]] SVInt slice(int32_t msb, int32_t lsb) const {
+        if (isSingleWord() && lsb >= 0 && msb >= lsb && bitwidth_t(msb) < bitWidth)
+            return fromWord(bitwidth_t(msb - lsb + 1), val >> lsb, false);
+        return sliceSlowCase(msb, lsb);
+    }
 
     /// Replace a range of bits in the number with the given bit pattern.
     void set(int32_t msb, int32_t lsb, const SVInt& value);
@@ -476,14 +495,56 @@ public:
     SVInt operator~() const;
     logic_t operator!() const { return !reductionOr(); }
 
-    SVInt operator+(const SVInt& rhs) const;
-    SVInt operator-(const SVInt& rhs) const;
-    SVInt operator*(const SVInt& rhs) const;
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator+(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val + rhs.val, signFlag);
+
+        SVInt tmp(*this);
+        tmp += rhs;
+        return tmp;
+    }
+
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator-(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val - rhs.val, signFlag);
+
+        SVInt tmp(*this);
+        tmp -= rhs;
+        return tmp;
+    }
+
+    SLANG_NO_SANITIZE("unsigned-integer-overflow")
+    SVInt operator*(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val * rhs.val, signFlag);
+
+        SVInt tmp(*this);
+        tmp *= rhs;
+        return tmp;
+    }
+
     SVInt operator/(const SVInt& rhs) const;
     SVInt operator%(const SVInt& rhs) const;
-    SVInt operator&(const SVInt& rhs) const;
-    SVInt operator|(const SVInt& rhs) const;
-    SVInt operator^(const SVInt& rhs) const;
+
+    SVInt operator&(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val & rhs.val, signFlag);
+        return andSlowCase(rhs);
+    }
+
+    SVInt operator|(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val | rhs.val, signFlag);
+        return orSlowCase(rhs);
+    }
+
+    SVInt operator^(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs))
+            return fromWord(bitWidth, val ^ rhs.val, signFlag);
+        return xorSlowCase(rhs);
+    }
 
     /// Equality operator; if either value is unknown the result is unknown.
     /// Otherwise, if bit lengths are unequal we extend the smaller one and then compare.
@@ -495,7 +556,14 @@ public:
 
     logic_t operator!=(const SVInt& rhs) const { return !((*this) == rhs); }
 
-    logic_t operator<(const SVInt& rhs) const;
+    logic_t operator<(const SVInt& rhs) const {
+        if (isSameSizeWord(rhs)) {
+            if (signFlag && rhs.signFlag)
+                return logic_t(signExtendedWord() < rhs.signExtendedWord());
+            return logic_t(val < rhs.val);
+        }
+        return lessThanSlowCase(rhs);
+    }
     logic_t operator<=(const SVInt& rhs) const { return (*this < rhs) || (*this == rhs); }
     logic_t operator>(const SVInt& rhs) const { return !(*this <= rhs); }
     logic_t operator>=(const SVInt& rhs) const { return !(*this < rhs); }
@@ -583,6 +651,38 @@ private:
     uint64_t* getRawData() { return isSingleWord() ? &val : pVal; }
     const uint64_t* getRawData() const { return isSingleWord() ? &val : pVal; }
 
+    // Constructs a fully known value of at most 64 bits, masking off any
+    // bits in the given word that are above the width.
+    static SVInt fromWord(bitwidth_t bits, uint64_t value, bool signFlag) {
+        SVInt result;
+        result.bitWidth = bits;
+        result.signFlag = signFlag;
+        result.val = bits == BITS_PER_WORD ? value : value & ((1ull << bits) - 1);
+        return result;
+    }
+
+    // Checks whether both values are fully known, fit in a single word, and
+    // have the same width, which lets most operations work on the raw words.
+    bool isSameSizeWord(const SVInt& rhs) const {
+        return isSingleWord() && rhs.isSingleWord() && bitWidth == rhs.bitWidth;
+    }
+
+    // Gets the value of a single word integer sign extended to 64 bits.
+    int64_t signExtendedWord() const {
+        const uint32_t shift = BITS_PER_WORD - bitWidth;
+        return int64_t(val << shift) >> shift;
+    }
+
+    // Slow cases for operations that have inline fast paths for single word values.
+    SVInt shlSlowCase(bitwidth_t amount) const;
+    SVInt ashrSlowCase(bitwidth_t amount) const;
+    SVInt lshrSlowCase(bitwidth_t amount) const;
+    SVInt sliceSlowCase(int32_t msb, int32_t lsb) const;
+    SVInt andSlowCase(const SVInt& rhs) const;
+    SVInt orSlowCase(const SVInt& rhs) const;
+    SVInt xorSlowCase(const SVInt& rhs) const;
+    logic_t lessThanSlowCase(const SVInt& rhs) const;
+
     // Slow cases for assignment, equality checking, and counting leading zeros.
     SVInt& assignSlowCase(const SVInt& other);
     logic_t equalsSlowCase(const SVInt& rhs) const;
@@ -634,6 +734,23 @@ private:
     // Unsigned modular exponentiation algorithm.
     static SVInt modPow(const SVInt& base, const SVInt& exponent, bool bothSigned);
 
+    // Unsigned division that produces both the quotient and the remainder, picking
+    // the best algorithm based on the sizes of the operands.
+    static void udivrem(const SVInt& lhs, const SVInt& rhs, SVInt& quotient, SVInt& remainder);
+
+    // Recursive (Burnikel-Ziegler) division for very wide operands.
+    static void divideRecursive(const SVInt& lhs, const SVInt& rhs, SVInt& quotient,
+                                SVInt& remainder);
+    static void divide2n1n(const SVInt& a, const SVInt& b, bitwidth_t n, SVInt& quotient,
+                           SVInt& remainder);
+    static void divide3n2n(const SVInt& a12, const SVInt& a3, const SVInt& b, const SVInt& b1,
+                           const SVInt& b2, bitwidth_t n, SVInt& quotient, SVInt& remainder);
+
+    // Appends the decimal digits of a nonnegative value to the buffer, least
+    // significant digit first, padded with zeros to at least minDigits digits.
+    static void writeDecimalDigits(SmallVectorBase<char>& buffer, const SVInt& value,
+                                   std::span<const SVInt> powers, size_t minDigits);
+
     static constexpr uint32_t getNumWords(bitwidth_t bitWidth, bool unknown) {
         uint32_t value = (bitWidth + BITS_PER_WORD - 1) / BITS_PER_WORD;
         return unknown ? value * 2 : value;
@@ -32,6 +32,8 @@ struct PragmaExpressionSyntax;
 
 namespace slang::parsing {
 
+class PreprocessorSnapshot;
+
 /// Contains various options that can control preprocessing behavior.
 struct SLANG_EXPORT PreprocessorOptions {
     /// The maximum depth of the include stack; further attempts to include
@@ -57,6 +59,10 @@ struct SLANG_EXPORT PreprocessorOptions {
 
     /// A set of preprocessor directives to be ignored.
     flat_hash_set<std::string_view> ignoreDirectives;
+
+    /// A snapshot of preprocessor state to restore at the start of preprocessing,
+    /// as if the headers it was created from had been included first.
+    std::shared_ptr<const PreprocessorSnapshot> snapshot;
 };
 
 /// Preprocessor - Interface between lexer and parser
@@ -147,6 +153,22 @@ public:
     /// Gets all macros that have been defined thus far in the preprocessor.
     std::vector<const syntax::DefineDirectiveSyntax*> getDefinedMacros() const;
 
+    /// Saves the currently defined macros and the set of headers that have been
+    /// marked `pragma once or found to have include guards into @a snapshot.
+    /// Built-in and command line macros are not included. The saved macros point
+    /// into the preprocessor's allocator, which must outlive the snapshot.
+    void saveSnapshot(PreprocessorSnapshot& snapshot) const;
+
+    /// Restores the state saved in @a snapshot. Its macros replace any existing
+    /// definitions with the same name, and its `pragma once and guarded headers
+    /// will be skipped if they are included again.
+    void restoreSnapshot(const PreprocessorSnapshot& snapshot);
+
+    /// Gets the number of `include directives that were skipped without reading
+    /// the header because it was detected to have an include guard whose macro
+    /// was already defined.
+    uint32_t getNumSkippedIncludes() const { return numSkippedIncludes; }
+
 private:
     Preprocessor(const Preprocessor& other);
     Preprocessor& operator=(const Preprocessor& other) = delete;
@@ -155,6 +177,9 @@ private:
     Token nextProcessed();
     Token nextRaw();
     void popSource();
+    void trackIncludeGuard(Token token);
+    void checkIncludeGuardElse();
+    bool isIncludeGuarded(const SourceBuffer& buffer) const;
 
     // directive handling methods
     Token handleDirectives(Token token);
@@ -383,6 +408,28 @@ private:
     // stack of active lexers; each `include pushes a new lexer
     SmallVector<std::unique_ptr<Lexer>, 2> lexerStack;
 
+    // Tracks whether the file being lexed by the corresponding entry in lexerStack
+    // has the form of a classic include guard:
+    //    `ifndef NAME ... `endif
+    // with nothing but trivia outside of the conditional block.
+    struct IncludeGuardState {
+        enum State : uint8_t { Start, ExpectIfNDef, Inside, Done, Invalid };
+
+        // The file's buffer.
+        SourceBuffer buffer;
+
+        // The name of the guard macro, once it has been seen.
+        std::string_view name;
+
+        // The depth of the branch stack outside of the guard block.
+        size_t branchDepth = 0;
+
+        State state = Start;
+
+        explicit IncludeGuardState(const SourceBuffer& buffer) : buffer(buffer) {}
+    };
+    SmallVector<IncludeGuardState, 2> guardStack;
+
     // keep track of nested processor branches (ifdef, ifndef, else, elsif, endif)
     SmallVector<BranchEntry, 2> branchStack;
 
@@ -412,7 +459,21 @@ private:
 
     // A set of files (identified by a pointer to the start of their text buffer) that
     // have been marked `pragma once so that we avoid trying to include them more than once.
-    flat_hash_set<const char*> includeOnceHeaders;
+    flat_hash_map<const char*, BufferID> includeOnceHeaders;
+
+    // Full paths of `pragma once headers restored from a snapshot; these are matched
+    // by path since their buffers may not have been loaded yet.
+    flat_hash_set<std::string> includeOncePaths;
+
+    // A map of files (identified by a pointer to the start of their text buffer) that
+    // were found to be wrapped in an include guard, to the name of the guard macro.
+    flat_hash_map<const char*, std::pair<std::string_view, BufferID>> includeGuards;
+
+    // Guarded headers restored from a snapshot, keyed by full path.
+    flat_hash_map<std::string, std::string> includeGuardPaths;
+
+    // The number of includes skipped because of a defined include guard.
+    uint32_t numSkippedIncludes = 0;
 
     /// Various state set by preprocessor directives.
     std::vector<KeywordVersion> keywordVersionStack;
@@ -442,4 +503,50 @@ private:
         pragmaProtectHandlers;
 };
 
+/// A saved copy of the macros defined by a Preprocessor, along with the set of headers
+/// it has seen marked `pragma once, taken after it has processed some prefix of its input.
+///
+/// This is the SystemVerilog equivalent of a precompiled header: large headers that get
+/// included by many compilation units (such as the UVM macro library) can be preprocessed
+/// once, with the resulting state restored at the start of each unit via
+/// PreprocessorOptions::snapshot instead of preprocessing the headers again every time.
+/// Snapshots can also be written out with serialize() and loaded again with deserialize()
+/// to reuse them across runs.
+class SLANG_EXPORT PreprocessorSnapshot {
+public:
+    /// The macros that were defined when the snapshot was taken, sorted by name.
+    std::vector<const syntax::DefineDirectiveSyntax*> macros;
+
+    /// The full paths of headers that had been marked with `pragma once.
+    std::vector<std::string> includeOnceHeaders;
+
+    /// The full paths of headers that were detected to be wrapped in an include
+    /// guard, along with the name of the guard macro, sorted by path.
+    std::vector<std::pair<std::string, std::string>> includeGuards;
+
+    /// Creates a snapshot by preprocessing each of the given @a buffers in order,
+    /// as if they had been included at the start of a compilation unit. Only
+    /// directives have an effect; any other tokens in the buffers are discarded.
+    /// Diagnostics issued along the way are added to @a diagnostics.
+    static std::shared_ptr<PreprocessorSnapshot> fromBuffers(
+        SourceManager& sourceManager, std::span<const SourceBuffer> buffers,
+        Diagnostics& diagnostics, const Bag& options = {});
+
+    /// Loads a snapshot from a buffer containing text that was previously produced
+    /// by serialize(). Macros loaded from it will report locations within that buffer.
+    static std::shared_ptr<PreprocessorSnapshot> deserialize(SourceManager& sourceManager,
+                                                             const SourceBuffer& buffer,
+                                                             Diagnostics& diagnostics,
+                                                             const Bag& options = {});
+
+    /// Serializes the snapshot to text that can be loaded with deserialize().
+    /// The result is SystemVerilog source containing each macro definition,
+    /// with the `pragma once headers listed in a comment block at the top.
+    std::string serialize() const;
+
+private:
+    // Storage for syntax created when preprocessing the snapshot's buffers.
+    BumpAllocator alloc;
+};
+
 } // namespace slang::parsing
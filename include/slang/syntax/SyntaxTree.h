@@ -186,6 +186,9 @@ public:
     /// Gets the allocator containing the memory for the parse tree.
     BumpAllocator& allocator() { return alloc; }
 
+    /// Gets statistics about the memory held for the parse tree.
+    BumpAllocatorStats getAllocatorStats() const { return alloc.getStats(); }
+
     /// Gets the source manager used to build the syntax tree.
     SourceManager& sourceManager() { return sourceMan; }
 
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "slang/util/Util.h"
@@ -34,7 +35,19 @@ public:
     /// and indentation are added to make the output more human friendly.
     void setPrettyPrint(bool enabled) { pretty = enabled; }
 
-    /// @return a view of the emitted JSON text so far.
+    /// Sets a function that is passed the emitted JSON text whenever more than
+    /// @a bufferSize bytes of it have been buffered, so that large documents
+    /// can be streamed to their destination instead of being held in memory
+    /// all at once. Call @a flush once writing is finished to pass along the
+    /// rest of the text.
+    void setOutput(std::function<void(std::string_view)> output, size_t bufferSize = 1 << 16);
+
+    /// Passes all of the buffered JSON text that is complete to the output
+    /// function set by @a setOutput.
+    void flush();
+
+    /// @return a view of the emitted JSON text so far. If an output function
+    /// has been set, this only includes text that hasn't been passed to it yet.
     /// @note the returned view is not guaranteed to remain valid once
     /// additional writes are performed.
     std::string_view view() const;
@@ -83,6 +96,8 @@ private:
     void writeQuoted(std::string_view str);
 
     std::unique_ptr<FormatBuffer> buffer;
+    std::function<void(std::string_view)> output;
+    size_t outputBufferSize = 0;
 
     int currentIndent = 0;
     int indentSize = 2;
@@ -26,6 +26,7 @@
 namespace slang {
 
 enum class DiagnosticSeverity;
+class MappedFile;
 
 template<typename T>
 concept IsLock = std::is_same_v<T, std::shared_lock<std::shared_mutex>> ||
@@ -172,6 +173,13 @@ public:
     /// disabled to always use the simple filename.
     void setDisableProximatePaths(bool set) { disableProximatePaths = set; }
 
+    /// Sets whether files read from disk should be memory mapped instead of
+    /// copied into heap buffers. Files that can't be mapped with a guaranteed
+    /// trailing null terminator are still read normally. This is off by default.
+    /// @warning Files must not be modified on disk while the source manager
+    /// holds a mapping to them.
+    void setMemoryMapFiles(bool set) { memoryMapFiles = set; }
+
     /// Adds a line directive at the given location.
     void addLineDirective(SourceLocation location, size_t lineNum, std::string_view name,
                           uint8_t level);
@@ -233,15 +241,16 @@ private:
     // Stores actual file contents and metadata; only one per loaded file
     struct FileData {
         const std::string name;                       // name of the file
-        const SmallVector<char> mem;                  // file contents
+        const SmallVector<char> mem;                  // file contents, if read into memory
+        const std::unique_ptr<MappedFile> mapping;    // file contents, if memory mapped
+        const std::string_view text;                  // view of contents, null terminated
         std::vector<size_t> lineOffsets;              // cache of compute line offsets
         const std::filesystem::path* const directory; // directory in which the file exists
         const std::filesystem::path fullPath;         // full path to the file
 
         FileData(const std::filesystem::path* directory, std::string name, SmallVector<char>&& data,
-                 std::filesystem::path fullPath) :
-            name(std::move(name)), mem(std::move(data)), directory(directory),
-            fullPath(std::move(fullPath)) {}
+                 std::unique_ptr<MappedFile>&& mapping, std::filesystem::path fullPath);
+        ~FileData();
     };
 
     // Stores a pointer to file data along with information about where we included it.
@@ -311,6 +320,7 @@ private:
 
     std::atomic<uint32_t> unnamedBufferCount = 0;
     bool disableProximatePaths = false;
+    bool memoryMapFiles = false;
 
     template<IsLock TLock>
     FileInfo* getFileInfo(BufferID buffer, TLock& lock);
@@ -326,7 +336,8 @@ private:
                              const SourceLibrary* library, uint64_t sortKey = UINT64_MAX);
     SourceBuffer cacheBuffer(std::filesystem::path&& path, std::string&& pathStr,
                              SourceLocation includedFrom, const SourceLibrary* library,
-                             uint64_t sortKey, SmallVector<char>&& buffer);
+                             uint64_t sortKey, SmallVector<char>&& buffer,
+                             std::unique_ptr<MappedFile>&& mapping = nullptr);
 
     template<IsLock TLock>
     size_t getRawLineNumber(SourceLocation location, TLock& lock) const;
@@ -346,8 +357,7 @@ private:
     template<IsLock TLock>
     SourceRange getExpansionRangeImpl(SourceLocation location, TLock& lock) const;
 
-    static void computeLineOffsets(const SmallVector<char>& buffer,
-                                   std::vector<size_t>& offsets) noexcept;
+    static void computeLineOffsets(std::string_view buffer, std::vector<size_t>& offsets) noexcept;
 };
 
 } // namespace slang
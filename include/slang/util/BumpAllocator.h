@@ -15,14 +15,66 @@
 
 namespace slang {
 
+/// Controls how a BumpAllocator requests memory from the system.
+struct SLANG_EXPORT BumpAllocatorOptions {
+    /// The size of the first segment allocated once the initial one fills up.
+    size_t segmentSize = 4096;
+
+    /// The size of newly allocated segments doubles each time this many
+    /// segments have been allocated, up to maxSegmentSize. A value of
+    /// zero disables growth so that all segments are segmentSize bytes.
+    uint32_t segmentsPerDoubling = 8;
+
+    /// The largest size that segments are allowed to grow to.
+    size_t maxSegmentSize = 1024 * 1024;
+
+    /// If true, segments at least as large as a huge page are allocated in
+    /// multiples of the huge page size and the OS is asked to back them with
+    /// huge pages. This is only supported on Linux and is ignored elsewhere.
+    bool useHugePages = false;
+};
+
+/// Statistics about the memory held by a BumpAllocator.
+struct SLANG_EXPORT BumpAllocatorStats {
+    /// The total number of bytes handed out by allocations, including
+    /// any padding needed to satisfy their alignment.
+    size_t bytesUsed = 0;
+
+    /// The total number of bytes reserved from the system for segments.
+    size_t bytesReserved = 0;
+
+    /// The number of segments currently owned by the allocator.
+    size_t segmentCount = 0;
+
+    /// The number of reserved bytes that aren't being used to satisfy allocations,
+    /// including segment headers and unused space at the end of each segment.
+    size_t wastedBytes() const { return bytesReserved - bytesUsed; }
+
+    BumpAllocatorStats& operator+=(const BumpAllocatorStats& other) {
+        bytesUsed += other.bytesUsed;
+        bytesReserved += other.bytesReserved;
+        segmentCount += other.segmentCount;
+        return *this;
+    }
+};
+
 /// BumpAllocator - Fast O(1) allocator.
 ///
 /// Allocates items sequentially in memory, with underlying memory allocated in
 /// blocks as needed. Individual items cannot be deallocated; the entire thing
 /// must be destroyed to release the memory.
+///
+/// Blocks start out small and grow geometrically as more of them are allocated
+/// (see BumpAllocatorOptions), so that very large allocators don't end up with
+/// huge numbers of tiny blocks.
 class SLANG_EXPORT BumpAllocator {
 public:
+    /// Constructs an allocator that uses the default options.
     BumpAllocator();
+
+    /// Constructs an allocator that uses the given options.
+    explicit BumpAllocator(const BumpAllocatorOptions& options);
+
     ~BumpAllocator();
 
     BumpAllocator(BumpAllocator&& other) noexcept;
@@ -69,27 +121,43 @@ public:
     /// The other allocator will be in a moved-from state after the call.
     void steal(BumpAllocator&& other);
 
+    /// Gets statistics about the memory held by the allocator.
+    /// These are computed by walking the allocator's segments,
+    /// so this is not meant to be called in a hot path.
+    BumpAllocatorStats getStats() const;
+
+    /// Gets the options used by the allocator.
+    const BumpAllocatorOptions& getOptions() const { return options; }
+
 protected:
     // Allocations are tracked as a linked list of segments.
     struct Segment {
         Segment* prev;
         byte* current;
+        size_t size;
+        bool isHugePage;
     };
 
     Segment* head;
     byte* endPtr;
+    uint32_t numSegments = 0;
+    BumpAllocatorOptions options;
 
-    enum { INITIAL_SIZE = 512, SEGMENT_SIZE = 4096 };
+    enum { INITIAL_SIZE = 512, HUGE_PAGE_SIZE = 2 * 1024 * 1024 };
 
     // Slow path handling of allocation.
     byte* allocateSlow(size_t size, size_t alignment);
 
+    // Gets the size to use for the next regular segment.
+    size_t nextSegmentSize() const;
+
     static byte* alignPtr(byte* ptr, size_t alignment) {
         return reinterpret_cast<byte*>((reinterpret_cast<uintptr_t>(ptr) + alignment - 1) &
                                        ~(alignment - 1));
     }
 
-    static Segment* allocSegment(Segment* prev, size_t size);
+    Segment* allocSegment(Segment* prev, size_t size) const;
+    static void freeSegment(Segment* seg);
 };
 
 /// A strongly-typed version of the BumpAllocator, which has the additional
@@ -16,6 +16,32 @@
 
 namespace slang {
 
+/// A read-only memory mapping of the contents of a file on disk.
+class SLANG_EXPORT MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+    ~MappedFile();
+
+    /// Gets the mapped file contents. The returned view includes a trailing
+    /// null terminator that is guaranteed to follow the file's bytes.
+    std::string_view data() const { return {static_cast<const char*>(base), size}; }
+
+    /// Returns true if the object currently holds a mapping.
+    bool valid() const { return base != nullptr; }
+
+private:
+    friend class OS;
+
+    void unmap();
+
+    const void* base = nullptr;
+    size_t size = 0;
+};
+
 /// A collection of various OS-specific utility functions.
 class SLANG_EXPORT OS {
 public:
@@ -42,6 +68,19 @@ public:
     /// Note that the buffer will be null-terminated.
     static std::error_code readFile(const std::filesystem::path& path, SmallVector<char>& buffer);
 
+    /// Maps the file at @a path read-only into memory. If successful, the mapping
+    /// is placed into @a result -- otherwise, returns an error code.
+    ///
+    /// The mapping is only created when the OS is guaranteed to zero-fill the bytes
+    /// following the end of the file, so that the contents are null-terminated just
+    /// like they would be from @a readFile. For files where that doesn't hold (empty
+    /// files, files whose size is an exact multiple of the page size, and things like
+    /// pipes that can't be mapped) this returns std::errc::not_supported and the
+    /// caller should fall back to @a readFile.
+    ///
+    /// Note that the file must not be truncated by another process while mapped.
+    static std::error_code mapFile(const std::filesystem::path& path, MappedFile& result);
+
     /// Writes the given contents to the specified file.
     static void writeFile(const std::filesystem::path& path, std::string_view contents);
 
@@ -7,12 +7,15 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <deque>
 #include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <type_traits>
 #include <vector>
@@ -21,7 +24,14 @@
 
 namespace slang {
 
-/// A lightweight thread pool for running concurrent jobs.
+/// @brief A lightweight thread pool for running concurrent jobs.
+///
+/// Each worker thread owns its own task queue. Tasks submitted from outside
+/// the pool are distributed round-robin across the queues, and tasks submitted
+/// from within a running task go onto the current worker's queue. Workers run
+/// tasks from the front of their own queue and, when it runs dry, steal from
+/// the back of other workers' queues, so that one long running task doesn't
+/// leave the rest of the pool idle.
 class ThreadPool {
 public:
     /// @brief Constructs a new ThreadPool.
@@ -38,12 +48,15 @@ public:
 
         {
             std::unique_lock lock(mutex);
-            waiting = false;
             running = true;
         }
 
+        queues.reserve(threadCount);
         for (unsigned i = 0; i < threadCount; i++)
-            threads.emplace_back(&ThreadPool::worker, this);
+            queues.emplace_back(std::make_unique<WorkQueue>());
+
+        for (unsigned i = 0; i < threadCount; i++)
+            threads.emplace_back(&ThreadPool::worker, this, size_t(i));
     }
 
     /// Destroys the thread pool, blocking until all threads have exited.
@@ -67,11 +80,30 @@ public:
     ///
     /// There is no way to wait for the pushed task to complete aside from
     /// calling @a waitForAll and waiting for all tasks in the pool to complete.
-    template<typename TFunc, typename... TArgs>
-    void pushTask(TFunc&& task, TArgs&&... args) {
+    template<typename TFunc, typename TArgs0, typename... TArgs>
+    void pushTask(TFunc&& task, TArgs0&& arg0, TArgs&&... args) {
+        pushTask(std::bind(std::forward<TFunc>(task), std::forward<TArgs0>(arg0),
+                           std::forward<TArgs>(args)...));
+    }
+
+    /// @brief Pushes a new task into the pool for execution.
+    ///
+    /// There is no way to wait for the pushed task to complete aside from
+    /// calling @a waitForAll and waiting for all tasks in the pool to complete.
+    template<typename TFunc>
+    void pushTask(TFunc&& task) {
         {
+            // Counting the task before it becomes visible in a queue ensures
+            // that a worker can never pop it and finish it before it's counted.
             std::unique_lock lock(mutex);
-            tasks.emplace_back(std::bind(std::forward<TFunc>(task), std::forward<TArgs>(args)...));
+            ++queuedTasks;
+            ++unfinishedTasks;
+        }
+
+        auto& queue = *queues[pickQueue()];
+        {
+            std::unique_lock lock(queue.mutex);
+            queue.tasks.emplace_back(std::forward<TFunc>(task));
         }
 
         taskAvailable.notify_one();
@@ -112,13 +144,15 @@ public:
     /// the loop given by [from, to).
     ///
     /// The loop will be broken into a number of blocks as specified by
-    /// @a numBlocks -- or if zero, the number of blocks will be set to
-    /// the number of threads in the pool.
+    /// @a numBlocks -- or if zero, into several blocks per thread so that
+    /// idle threads can steal work when iterations vary widely in cost.
+    /// Blocks are pushed in index order, so callers that sort their work
+    /// from most to least expensive get those blocks started first.
     template<typename TIndex, typename TFunc>
     void pushLoop(TIndex from, TIndex to, TFunc&& body, size_t numBlocks = 0) {
         SLANG_ASSERT(to >= from);
         if (!numBlocks)
-            numBlocks = getThreadCount();
+            numBlocks = getThreadCount() * BlocksPerThread;
 
         const size_t totalSize = size_t(to - from);
         if (!totalSize)
@@ -133,16 +167,14 @@ public:
         for (size_t i = 0; i < numBlocks; i++) {
             const TIndex start = TIndex(i * blockSize) + from;
             const TIndex end = i == numBlocks - 1 ? to : TIndex(start + blockSize);
-            pushTask(std::forward<TFunc>(body), start, end);
+            pushTask(body, start, end);
         }
     }
 
     /// Blocks the calling thread until all running tasks are complete.
     void waitForAll() {
         std::unique_lock lock(mutex);
-        waiting = true;
-        taskDone.wait(lock, [this] { return !currentTasks && tasks.empty(); });
-        waiting = false;
+        taskDone.wait(lock, [this] { return unfinishedTasks == 0; });
     }
 
     /// Blocks the calling thread until all running tasks are complete, or
@@ -151,42 +183,115 @@ public:
     template<typename R, typename P>
     bool waitForAll(const std::chrono::duration<R, P>& duration) {
         std::unique_lock lock(mutex);
-        waiting = true;
-        const bool status = taskDone.wait_for(lock, duration,
-                                              [this] { return !currentTasks && tasks.empty(); });
-        waiting = false;
-        return status;
+        return taskDone.wait_for(lock, duration, [this] { return unfinishedTasks == 0; });
     }
 
 private:
-    void worker() {
+    // The number of blocks per thread that pushLoop splits work into by default.
+    static constexpr size_t BlocksPerThread = 8;
+
+    struct WorkQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    size_t pickQueue() {
+        // Tasks pushed from one of our own workers stay local to that worker;
+        // everything else gets spread evenly across the queues.
+        if (currentPool == this)
+            return currentIndex;
+        return nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    }
+
+    bool tryPop(size_t index, std::function<void()>& task) {
+        // Take from the front of our own queue first, in submission order.
+        {
+            auto& queue = *queues[index];
+            std::unique_lock lock(queue.mutex);
+            if (!queue.tasks.empty()) {
+                task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                return true;
+            }
+        }
+
+        // Otherwise steal from the back of someone else's queue.
+        for (size_t i = 1; i < queues.size(); i++) {
+            auto& queue = *queues[(index + i) % queues.size()];
+            std::unique_lock lock(queue.mutex, std::try_to_lock);
+            if (lock.owns_lock() && !queue.tasks.empty()) {
+                task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void worker(size_t index) {
+        currentPool = this;
+        currentIndex = index;
+
+        std::function<void()> task;
         while (true) {
+            if (tryPop(index, task)) {
+                --queuedTasks;
+                task();
+                task = nullptr;
+
+                if (--unfinishedTasks == 0) {
+                    std::unique_lock lock(mutex);
+                    taskDone.notify_all();
+                }
+                continue;
+            }
+
+            // Nothing to do; sleep until more work shows up. If the count says
+            // there are queued tasks we lost a race (or a try_lock) for them,
+            // so just go around again.
             std::unique_lock lock(mutex);
-            taskAvailable.wait(lock, [this] { return !tasks.empty() || !running; });
+            taskAvailable.wait(lock, [this] { return queuedTasks != 0 || !running; });
             if (!running)
                 break;
-
-            auto task = std::move(tasks.front());
-            tasks.pop_front();
-            ++currentTasks;
-            lock.unlock();
-            task();
-            lock.lock();
-            --currentTasks;
-
-            if (waiting && !currentTasks && tasks.empty())
-                taskDone.notify_all();
         }
+
+        currentPool = nullptr;
     }
 
+    static inline thread_local const ThreadPool* currentPool = nullptr;
+    static inline thread_local size_t currentIndex = 0;
+
     std::mutex mutex;
-    std::deque<std::function<void()>> tasks;
+    std::vector<std::unique_ptr<WorkQueue>> queues;
     std::condition_variable taskAvailable;
     std::condition_variable taskDone;
     std::vector<std::thread> threads;
-    size_t currentTasks = 0;
+    std::atomic<size_t> queuedTasks = 0;
+    std::atomic<size_t> unfinishedTasks = 0;
+    std::atomic<size_t> nextQueue = 0;
     bool running;
-    bool waiting;
 };
 
+/// Returns the indices of the given items ordered from largest to smallest
+/// estimated cost, as computed by @a getCost, so that a thread pool can be
+/// given the most expensive work first instead of finding it stuck at the end
+/// of some thread's queue. Items with equal cost keep their original order.
+template<typename T, typename TCost>
+std::vector<size_t> orderByCost(std::span<T> items, TCost&& getCost) {
+    std::vector<std::pair<uint64_t, size_t>> costs;
+    costs.reserve(items.size());
+    for (size_t i = 0; i < items.size(); i++)
+        costs.emplace_back(getCost(items[i]), i);
+
+    std::ranges::stable_sort(costs, std::ranges::greater{},
+                             [](auto& pair) { return pair.first; });
+
+    std::vector<size_t> order;
+    order.reserve(costs.size());
+    for (auto& [_, index] : costs)
+        order.push_back(index);
+    return order;
+}
+
 } // namespace slang
@@ -7,9 +7,13 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include <chrono>
+#include <initializer_list>
 #include <iosfwd>
 #include <memory>
 #include <string>
+#include <thread>
+#include <utility>
 
 #include "slang/util/Function.h"
 #include "slang/util/Util.h"
@@ -45,6 +49,26 @@ public:
     /// Ends tracing a section previously started by @a beginTrace
     static void endTrace();
 
+    /// Records a complete section that was measured by the caller instead of
+    /// via @a beginTrace and @a endTrace, attributed to the given thread.
+    /// This is useful for summarizing work done across many small tasks,
+    /// such as the total time a worker thread spent busy.
+    /// @param name the name of the section
+    /// @param detail extra details to include in the trace about the section
+    /// @param threadId the thread to which the section should be attributed
+    /// @param start the point in time at which the section starts
+    /// @param duration the length of the section
+    static void addSection(std::string_view name, std::string_view detail,
+                           std::thread::id threadId, std::chrono::steady_clock::time_point start,
+                           std::chrono::steady_clock::duration duration);
+
+    /// Records the current values of a group of named counters, such as cache
+    /// hit rates, which are shown alongside the traced sections.
+    /// @param name the name of the counter group
+    /// @param values the name and value of each counter in the group
+    static void addCounter(std::string_view name,
+                           std::initializer_list<std::pair<std::string_view, uint64_t>> values);
+
 private:
     TimeTrace() = delete;
 
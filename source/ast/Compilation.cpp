@@ -9,6 +9,7 @@
 
 #include "ElabVisitors.h"
 #include "builtins/Builtins.h"
+#include <atomic>
 #include <fmt/core.h>
 #include <mutex>
 
@@ -40,9 +41,13 @@ const PackageSymbol& createStdPackage(Compilation&);
 namespace slang::ast {
 
 Compilation::Compilation(const Bag& options, const SourceLibrary* defaultLib) :
+    BumpAllocator(options.getOrDefault<BumpAllocatorOptions>()),
     options(options.getOrDefault<CompilationOptions>()), driverMapAllocator(*this),
     unrollIntervalMapAllocator(*this), tempDiag({}, {}), defaultLibPtr(defaultLib) {
 
+    static std::atomic<uint64_t> nextCompilationId = 1;
+    compilationId = nextCompilationId++;
+
     // Construct all built-in types.
     auto& bi = slang::ast::builtins::Builtins::Instance;
     bitType = &bi.bitType;
@@ -1306,14 +1311,24 @@ CompilationUnitSymbol& Compilation::createScriptScope() {
 }
 
 void Compilation::elaborate() {
+    uint32_t errorLimit = options.errorLimit == 0 ? UINT32_MAX : options.errorLimit;
+    if (hasFlag(CompilationFlags::HierarchyOnly)) {
+        // Only the instance tree and parameter values are wanted, so skip
+        // binding everything else along with the checks that depend on it.
+        HierarchyVisitor hierVisitor(*this, numErrors, errorLimit);
+        getRoot().visit(hierVisitor);
+        return;
+    }
+
     // Touch every symbol, scope, statement, and expression tree so that
     // we can be sure we have all the diagnostics.
-    uint32_t errorLimit = options.errorLimit == 0 ? UINT32_MAX : options.errorLimit;
     DiagnosticVisitor elabVisitor(*this, numErrors, errorLimit);
     getRoot().visit(elabVisitor);
 
-    if (elabVisitor.finishedEarly())
+    if (elabVisitor.finishedEarly()) {
+        elabVisitor.countSharedInstances();
         return;
+    }
 
     elabVisitor.finalize();
 
@@ -1466,6 +1481,22 @@ const Diagnostics& Compilation::getParseDiagnostics() {
     return *cachedParseDiagnostics;
 }
 
+// Returns the number of instances in the design represented by the given body,
+// taking into account instances that share elaboration results with it.
+static size_t getNumRepresentedInstances(const InstanceBodySymbol& body) {
+    size_t result = 1;
+    auto curr = &body;
+    while (curr) {
+        result += curr->getNumSharedInstances();
+        if (!curr->parentInstance)
+            break;
+
+        auto scope = curr->parentInstance->getParentScope();
+        curr = scope ? scope->getContainingInstance() : nullptr;
+    }
+    return result;
+}
+
 const Diagnostics& Compilation::getSemanticDiagnostics() {
     if (cachedSemanticDiagnostics)
         return *cachedSemanticDiagnostics;
@@ -1520,10 +1551,13 @@ const Diagnostics& Compilation::getSemanticDiagnostics() {
             if (!symbol)
                 continue;
 
-            auto parent = symbol->as<InstanceBodySymbol>().parentInstance;
+            auto& body = symbol->as<InstanceBodySymbol>();
+            auto parent = body.parentInstance;
             SLANG_ASSERT(parent);
 
-            count++;
+            // If other instances shared the elaboration of this body (or of
+            // one of its parents) then the diagnostic applies to them as well.
+            count += getNumRepresentedInstances(body);
             if (auto scope = parent->getParentScope()) {
                 auto& sym = scope->asSymbol();
                 if (sym.kind != SymbolKind::Root && sym.kind != SymbolKind::CompilationUnit) {
@@ -1642,6 +1676,55 @@ Scope::WildcardImportData* Compilation::allocWildcardImportData() {
     return wildcardImportAllocator.emplace();
 }
 
+BumpAllocator& Compilation::getThreadArena() {
+    // Remember the last arena each thread used so that repeated requests
+    // don't need to take the lock. The ID check guards against the cache
+    // pointing at an arena from a compilation that has since been destroyed.
+    struct ArenaCache {
+        uint64_t compilationId = 0;
+        BumpAllocator* arena = nullptr;
+    };
+    thread_local ArenaCache cache;
+    if (cache.compilationId == compilationId)
+        return *cache.arena;
+
+    auto threadId = std::this_thread::get_id();
+    std::unique_lock lock(threadArenaMutex);
+
+    BumpAllocator* arena = nullptr;
+    for (auto& [id, ptr] : threadArenas) {
+        if (id == threadId) {
+            arena = ptr.get();
+            break;
+        }
+    }
+
+    if (!arena) {
+        auto& options = BumpAllocator::getOptions();
+        arena = threadArenas.emplace_back(threadId, std::make_unique<BumpAllocator>(options))
+                    .second.get();
+    }
+
+    cache = {compilationId, arena};
+    return *arena;
+}
+
+BumpAllocatorStats Compilation::getAllocatorStats() const {
+    auto stats = getStats();
+    stats += symbolMapAllocator.getStats();
+    stats += pointerMapAllocator.getStats();
+    stats += constantAllocator.getStats();
+    stats += genericClassAllocator.getStats();
+    stats += assertionDetailsAllocator.getStats();
+    stats += configBlockAllocator.getStats();
+    stats += wildcardImportAllocator.getStats();
+
+    std::unique_lock lock(threadArenaMutex);
+    for (auto& [id, arena] : threadArenas)
+        stats += arena->getStats();
+    return stats;
+}
+
 const ImplicitTypeSyntax& Compilation::createEmptyTypeSyntax(SourceLocation loc) {
     return *emplace<ImplicitTypeSyntax>(Token(), nullptr,
                                         Token(*this, TokenKind::Placeholder, {}, {}, loc));
@@ -1654,6 +1737,29 @@ void Compilation::forceElaborate(const Symbol& symbol) {
     symbol.visit(visitor);
 }
 
+std::optional<Compilation::MemoizedCall> Compilation::findMemoizedCall(
+    const ConstantCallKey& key) {
+    std::unique_lock lock(constantMemoMutex);
+    if (auto it = constantMemo.find(key); it != constantMemo.end()) {
+        constantMemoHits++;
+        return it->second;
+    }
+
+    constantMemoMisses++;
+    return std::nullopt;
+}
+
+void Compilation::memoizeCall(ConstantCallKey&& key, MemoizedCall&& call) {
+    std::unique_lock lock(constantMemoMutex);
+    if (constantMemo.size() < options.maxConstexprMemo)
+        constantMemo.emplace(std::move(key), std::move(call));
+}
+
+Compilation::ConstantMemoStats Compilation::getConstantMemoStats() const {
+    std::unique_lock lock(constantMemoMutex);
+    return {constantMemoHits, constantMemoMisses, constantMemo.size()};
+}
+
 const Type& Compilation::getType(SyntaxKind typeKind) const {
     auto it = knownTypes.find(typeKind);
     return it == knownTypes.end() ? *errorType : *it->second;
@@ -0,0 +1,871 @@
+//------------------------------------------------------------------------------
+// ConstantBytecode.cpp
+// Bytecode form of constant functions
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/ast/ConstantBytecode.h"
+
+#include "slang/ast/ASTVisitor.h"
+#include "slang/ast/Compilation.h"
+#include "slang/ast/EvalContext.h"
+#include "slang/ast/LValue.h"
+#include "slang/diagnostics/ConstEvalDiags.h"
+#include "slang/diagnostics/NumericDiags.h"
+
+namespace {
+
+using namespace slang;
+using namespace slang::ast;
+
+using ER = Statement::EvalResult;
+using Op = ConstantBytecode::Opcode;
+using Instruction = ConstantBytecode::Instruction;
+
+constexpr uint32_t LocalBit = ConstantBytecode::LocalBit;
+constexpr uint32_t NoReg = ConstantBytecode::NoReg;
+
+bool isIncDecOp(UnaryOperator op) {
+    switch (op) {
+        case UnaryOperator::Preincrement:
+        case UnaryOperator::Predecrement:
+        case UnaryOperator::Postincrement:
+        case UnaryOperator::Postdecrement:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool isShortCircuitOp(BinaryOperator op) {
+    switch (op) {
+        case BinaryOperator::LogicalAnd:
+        case BinaryOperator::LogicalOr:
+        case BinaryOperator::LogicalImplication:
+            return true;
+        default:
+            return false;
+    }
+}
+
+struct DisableFinder : public ASTVisitor<DisableFinder, true, false> {
+    bool found = false;
+
+    void handle(const DisableStatement&) { found = true; }
+};
+
+// Finds break and continue statements that aren't inside a loop within the
+// statement being searched, and so would jump to a target outside of it.
+struct LoopJumpFinder : public ASTVisitor<LoopJumpFinder, true, false> {
+    bool found = false;
+
+    void handle(const BreakStatement&) { found = true; }
+    void handle(const ContinueStatement&) { found = true; }
+
+    void handle(const ForLoopStatement&) {}
+    void handle(const RepeatLoopStatement&) {}
+    void handle(const ForeachLoopStatement&) {}
+    void handle(const WhileLoopStatement&) {}
+    void handle(const DoWhileLoopStatement&) {}
+    void handle(const ForeverLoopStatement&) {}
+};
+
+// Finds expressions that can modify local variables, which means that the
+// value of a local read earlier in the same expression must be copied out
+// before evaluating them.
+struct SideEffectFinder : public ASTVisitor<SideEffectFinder, false, true> {
+    bool found = false;
+
+    void handle(const AssignmentExpression&) { found = true; }
+
+    void handle(const UnaryExpression& expr) {
+        if (isIncDecOp(expr.op))
+            found = true;
+        else
+            visitDefault(expr);
+    }
+};
+
+struct LValueRefFinder : public ASTVisitor<LValueRefFinder, false, true> {
+    bool found = false;
+
+    void handle(const LValueReferenceExpression&) { found = true; }
+};
+
+template<typename TFinder, typename T>
+bool contains(const T& node) {
+    TFinder finder;
+    node.visit(finder);
+    return finder.found;
+}
+
+class BytecodeCompiler {
+public:
+    explicit BytecodeCompiler(const SubroutineSymbol& subroutine) : subroutine(subroutine) {}
+
+    const ConstantBytecode* compile() {
+        auto& body = subroutine.getBody();
+        if (body.bad() || contains<DisableFinder>(body))
+            return nullptr;
+
+        // Jumps are resolved against the loops being compiled, so a break or
+        // continue outside of any loop would be left without a target.
+        if (contains<LoopJumpFinder>(body))
+            return nullptr;
+
+        // Arguments and the return value have already been created by the
+        // caller by the time the program runs, so bind them up front.
+        for (auto arg : subroutine.getArguments())
+            bindLocal(*arg);
+
+        SLANG_ASSERT(subroutine.returnValVar);
+        returnSlot = bindLocal(*subroutine.returnValVar);
+
+        compileStmt(body);
+        emit(Op::Exit);
+
+        auto& comp = subroutine.getCompilation();
+        auto result = comp.emplace<ConstantBytecode>();
+        result->instructions = code.copy(comp);
+        result->numLocals = numLocals;
+        result->numTemps = maxTemps;
+        result->numCounters = numCounters;
+        result->numLValues = maxLValues;
+        return result;
+    }
+
+private:
+    struct Loop {
+        SmallVector<std::pair<size_t, uint32_t Instruction::*>> breaks;
+        SmallVector<std::pair<size_t, uint32_t Instruction::*>> continues;
+    };
+
+    struct LValueTarget {
+        uint32_t slot;
+        bool needsPush = false;
+    };
+
+    const SubroutineSymbol& subroutine;
+    SmallVector<Instruction> code;
+    flat_hash_map<const ValueSymbol*, uint32_t> localSlots;
+    SmallVector<Loop*> loops;
+    SmallVector<LValueTarget> lvalueTargets;
+    uint32_t returnSlot = NoReg;
+    uint32_t numLocals = 0;
+    uint32_t curTemps = 0;
+    uint32_t maxTemps = 0;
+    uint32_t numCounters = 0;
+    uint32_t curLValues = 0;
+    uint32_t maxLValues = 0;
+
+    size_t emit(Op op, uint32_t dst = 0, uint32_t a = 0, uint32_t b = 0, uint32_t c = 0) {
+        Instruction inst;
+        inst.op = op;
+        inst.dst = dst;
+        inst.a = a;
+        inst.b = b;
+        inst.c = c;
+        code.push_back(inst);
+        return code.size() - 1;
+    }
+
+    uint32_t here() const { return uint32_t(code.size()); }
+
+    uint32_t newTemp() {
+        maxTemps = std::max(maxTemps, curTemps + 1);
+        return curTemps++;
+    }
+
+    static bool isTemp(uint32_t reg) { return (reg & LocalBit) == 0; }
+
+    static bool canBindLocal(const ValueSymbol& symbol) {
+        // Class and covergroup handles issue diagnostics whenever they
+        // are referenced, so leave those to the tree walker.
+        auto& type = symbol.getType();
+        return !type.isClass() && !type.isCovergroup();
+    }
+
+    uint32_t bindLocal(const ValueSymbol& symbol) {
+        uint32_t slot = numLocals++ | LocalBit;
+        if (canBindLocal(symbol))
+            localSlots[&symbol] = slot;
+
+        code[emit(Op::BindLocal, slot)].symbol = &symbol;
+        return slot;
+    }
+
+    std::optional<uint32_t> findSlot(const Expression& expr) const {
+        if (expr.kind != ExpressionKind::NamedValue)
+            return std::nullopt;
+
+        auto it = localSlots.find(&expr.as<NamedValueExpression>().symbol);
+        if (it == localSlots.end())
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    // If reg is a local slot that might get modified by evaluating
+    // the given expression, copies it into a temporary first.
+    uint32_t protect(uint32_t reg, const Expression& laterExpr) {
+        if (isTemp(reg) || !contains<SideEffectFinder>(laterExpr))
+            return reg;
+
+        auto temp = newTemp();
+        emit(Op::Move, temp, reg);
+        return temp;
+    }
+
+    void addJump(std::pair<size_t, uint32_t Instruction::*> patch, bool isBreak) {
+        SLANG_ASSERT(!loops.empty());
+        if (isBreak)
+            loops.back()->breaks.push_back(patch);
+        else
+            loops.back()->continues.push_back(patch);
+    }
+
+    void finishLoop(Loop& loop, uint32_t continueTarget, uint32_t breakTarget) {
+        for (auto [index, field] : loop.continues)
+            code[index].*field = continueTarget;
+        for (auto [index, field] : loop.breaks)
+            code[index].*field = breakTarget;
+        loops.pop_back();
+    }
+
+    void emitStep(const Statement& stmt) { code[emit(Op::Step)].stmt = &stmt; }
+
+    void delegate(const Statement& stmt) {
+        auto index = emit(Op::EvalStmt, 0, NoReg, NoReg);
+        code[index].stmt = &stmt;
+        if (!loops.empty()) {
+            addJump({index, &Instruction::a}, true);
+            addJump({index, &Instruction::b}, false);
+        }
+    }
+
+    uint32_t delegate(const Expression& expr) {
+        // If a compound assignment is being compiled, the tree walker will need
+        // to find the target on the context's lvalue stack.
+        if (!lvalueTargets.empty() && contains<LValueRefFinder>(expr))
+            lvalueTargets.back().needsPush = true;
+
+        auto dst = newTemp();
+        code[emit(Op::EvalExpr, dst)].expr = &expr;
+        return dst;
+    }
+
+    uint32_t loadConst(const ConstantValue* constant) {
+        auto dst = newTemp();
+        code[emit(Op::LoadConst, dst)].constant = constant;
+        return dst;
+    }
+
+    uint32_t loadConst(ConstantValue&& value) {
+        return loadConst(subroutine.getCompilation().allocConstant(std::move(value)));
+    }
+
+    void compileStmt(const Statement& stmt) {
+        auto savedTemps = curTemps;
+        compileStmtImpl(stmt);
+        curTemps = savedTemps;
+    }
+
+    void compileStmtImpl(const Statement& stmt) {
+        // Note that the steps emitted here must line up exactly with
+        // the ones taken by Statement::eval for the same statements.
+        switch (stmt.kind) {
+            case StatementKind::Empty:
+                emitStep(stmt);
+                return;
+            case StatementKind::List:
+                emitStep(stmt);
+                for (auto item : stmt.as<StatementList>().list)
+                    compileStmt(*item);
+                return;
+            case StatementKind::Block: {
+                auto& block = stmt.as<BlockStatement>();
+                if (block.blockKind != StatementBlockKind::Sequential)
+                    break;
+
+                emitStep(stmt);
+                compileStmt(block.body);
+                return;
+            }
+            case StatementKind::Return: {
+                emitStep(stmt);
+                if (auto expr = stmt.as<ReturnStatement>().expr)
+                    emit(Op::Move, returnSlot, compileExpr(*expr));
+                emit(Op::Return);
+                return;
+            }
+            case StatementKind::Break:
+            case StatementKind::Continue:
+                if (loops.empty())
+                    break;
+
+                emitStep(stmt);
+                addJump({emit(Op::Jump), &Instruction::a}, stmt.kind == StatementKind::Break);
+                return;
+            case StatementKind::VariableDeclaration: {
+                auto& symbol = stmt.as<VariableDeclStatement>().symbol;
+                if (symbol.lifetime == VariableLifetime::Static) {
+                    // Static initializers are skipped with a warning, which
+                    // the tree walker takes care of.
+                    delegate(stmt);
+                    bindLocal(symbol);
+                    return;
+                }
+
+                emitStep(stmt);
+                uint32_t init = NoReg;
+                if (auto initializer = symbol.getInitializer())
+                    init = compileExpr(*initializer);
+
+                uint32_t slot = numLocals++ | LocalBit;
+                if (canBindLocal(symbol))
+                    localSlots[&symbol] = slot;
+
+                code[emit(Op::DeclLocal, slot, init)].stmt = &stmt;
+                return;
+            }
+            case StatementKind::ExpressionStatement: {
+                auto& expr = stmt.as<ExpressionStatement>().expr;
+                if (expr.kind == ExpressionKind::Call && expr.as<CallExpression>().isSystemCall())
+                    break;
+
+                emitStep(stmt);
+                compileExpr(expr, /* discard */ true);
+                return;
+            }
+            case StatementKind::Conditional:
+                if (compileConditional(stmt.as<ConditionalStatement>()))
+                    return;
+                break;
+            case StatementKind::ForLoop:
+                compileForLoop(stmt.as<ForLoopStatement>());
+                return;
+            case StatementKind::WhileLoop: {
+                auto& loop = stmt.as<WhileLoopStatement>();
+                emitStep(stmt);
+
+                auto top = here();
+                auto exitJump = emit(Op::JumpIfFalse, 0, compileExpr(loop.cond));
+
+                Loop info;
+                loops.push_back(&info);
+                compileStmt(loop.body);
+                emit(Op::Jump, 0, top);
+
+                code[exitJump].b = here();
+                finishLoop(info, top, here());
+                return;
+            }
+            case StatementKind::DoWhileLoop: {
+                auto& loop = stmt.as<DoWhileLoopStatement>();
+                emitStep(stmt);
+
+                auto top = here();
+                Loop info;
+                loops.push_back(&info);
+                compileStmt(loop.body);
+
+                auto cont = here();
+                auto exitJump = emit(Op::JumpIfFalse, 0, compileExpr(loop.cond));
+                emit(Op::Jump, 0, top);
+
+                code[exitJump].b = here();
+                finishLoop(info, cont, here());
+                return;
+            }
+            case StatementKind::ForeverLoop: {
+                emitStep(stmt);
+
+                auto top = here();
+                Loop info;
+                loops.push_back(&info);
+                compileStmt(stmt.as<ForeverLoopStatement>().body);
+                emit(Op::Jump, 0, top);
+                finishLoop(info, top, here());
+                return;
+            }
+            case StatementKind::RepeatLoop: {
+                auto& loop = stmt.as<RepeatLoopStatement>();
+                if (!loop.count.type->isIntegral())
+                    break;
+
+                emitStep(stmt);
+                auto counter = numCounters++;
+                code[emit(Op::RepeatInit, counter, compileExpr(loop.count))].expr = &loop.count;
+
+                auto top = emit(Op::RepeatNext, counter);
+                Loop info;
+                loops.push_back(&info);
+                compileStmt(loop.body);
+                emit(Op::Jump, 0, uint32_t(top));
+
+                code[top].a = here();
+                finishLoop(info, uint32_t(top), here());
+                return;
+            }
+            default:
+                break;
+        }
+
+        delegate(stmt);
+    }
+
+    bool compileConditional(const ConditionalStatement& stmt) {
+        // Only plain if/else statements are compiled; else-if chains and
+        // unique / priority checks evaluate all of their conditions up front,
+        // so those go to the tree walker.
+        if (stmt.conditions.size() != 1 || stmt.conditions[0].pattern ||
+            stmt.check != UniquePriorityCheck::None ||
+            stmt.ifTrue.kind == StatementKind::Conditional ||
+            (stmt.ifFalse && stmt.ifFalse->kind == StatementKind::Conditional)) {
+            return false;
+        }
+
+        emitStep(stmt);
+        auto elseJump = emit(Op::JumpIfFalse, 0, compileExpr(*stmt.conditions[0].expr));
+        compileStmt(stmt.ifTrue);
+
+        if (stmt.ifFalse) {
+            auto endJump = emit(Op::Jump);
+            code[elseJump].b = here();
+            compileStmt(*stmt.ifFalse);
+            code[endJump].a = here();
+        }
+        else {
+            code[elseJump].b = here();
+        }
+        return true;
+    }
+
+    void compileForLoop(const ForLoopStatement& loop) {
+        emitStep(loop);
+        for (auto init : loop.initializers)
+            compileExpr(*init, /* discard */ true);
+
+        auto top = here();
+        size_t exitJump = SIZE_MAX;
+        if (loop.stopExpr)
+            exitJump = emit(Op::JumpIfFalse, 0, compileExpr(*loop.stopExpr));
+
+        Loop info;
+        loops.push_back(&info);
+        compileStmt(loop.body);
+
+        auto cont = here();
+        for (auto step : loop.steps)
+            compileExpr(*step, /* discard */ true);
+        emit(Op::Jump, 0, top);
+
+        if (exitJump != SIZE_MAX)
+            code[exitJump].b = here();
+        finishLoop(info, cont, here());
+    }
+
+    uint32_t compileExpr(const Expression& expr, bool discard = false) {
+        if (expr.constant)
+            return loadConst(expr.constant);
+
+        switch (expr.kind) {
+            case ExpressionKind::IntegerLiteral:
+                return loadConst(expr.as<IntegerLiteral>().getValue());
+            case ExpressionKind::RealLiteral:
+                return loadConst(real_t(expr.as<RealLiteral>().getValue()));
+            case ExpressionKind::UnbasedUnsizedIntegerLiteral:
+                return loadConst(expr.as<UnbasedUnsizedIntegerLiteral>().getValue());
+            case ExpressionKind::NamedValue:
+                if (auto slot = findSlot(expr))
+                    return *slot;
+                break;
+            case ExpressionKind::LValueReference:
+                if (!lvalueTargets.empty())
+                    return lvalueTargets.back().slot;
+                break;
+            case ExpressionKind::UnaryOp: {
+                auto& unary = expr.as<UnaryExpression>();
+                if (!isIncDecOp(unary.op)) {
+                    auto src = compileExpr(unary.operand());
+                    auto dst = newTemp();
+                    code[emit(Op::Unary, dst, src)].subOp = uint8_t(unary.op);
+                    return dst;
+                }
+
+                auto slot = findSlot(unary.operand());
+                if (!slot || !unary.operand().type->isIntegral())
+                    break;
+
+                auto dst = discard ? NoReg : newTemp();
+                code[emit(Op::IncDec, dst, *slot)].subOp = uint8_t(unary.op);
+                return dst;
+            }
+            case ExpressionKind::BinaryOp:
+                return compileBinary(expr.as<BinaryExpression>());
+            case ExpressionKind::ConditionalOp:
+                if (auto result = compileConditional(expr.as<ConditionalExpression>()))
+                    return *result;
+                break;
+            case ExpressionKind::Conversion: {
+                auto& conv = expr.as<ConversionExpression>();
+                auto src = compileExpr(conv.operand());
+                auto dst = newTemp();
+                code[emit(Op::Convert, dst, src)].expr = &conv;
+                return dst;
+            }
+            case ExpressionKind::Assignment:
+                if (auto result = compileAssignment(expr.as<AssignmentExpression>()))
+                    return *result;
+                break;
+            default:
+                break;
+        }
+
+        return delegate(expr);
+    }
+
+    uint32_t compileBinary(const BinaryExpression& expr) {
+        if (expr.left().kind == ExpressionKind::TypeReference &&
+            expr.right().kind == ExpressionKind::TypeReference) {
+            return delegate(expr);
+        }
+
+        auto lhs = protect(compileExpr(expr.left()), expr.right());
+        auto dst = newTemp();
+
+        size_t shortCircuit = SIZE_MAX;
+        if (isShortCircuitOp(expr.op)) {
+            shortCircuit = emit(Op::ShortCircuit, dst, lhs);
+            code[shortCircuit].subOp = uint8_t(expr.op);
+        }
+
+        auto rhs = compileExpr(expr.right());
+        code[emit(Op::Binary, dst, lhs, rhs)].subOp = uint8_t(expr.op);
+
+        if (shortCircuit != SIZE_MAX)
+            code[shortCircuit].b = here();
+        return dst;
+    }
+
+    std::optional<uint32_t> compileConditional(const ConditionalExpression& expr) {
+        // The merge rules for unknown predicates are only handled natively
+        // for integral and floating point results.
+        if (expr.conditions.size() != 1 || expr.conditions[0].pattern ||
+            (!expr.type->isIntegral() && !expr.type->isFloating())) {
+            return std::nullopt;
+        }
+
+        auto cond = compileExpr(*expr.conditions[0].expr);
+        auto branch = emit(Op::Branch, 0, cond);
+        auto dst = newTemp();
+
+        emit(Op::Move, dst, compileExpr(expr.left()));
+        auto endJump1 = emit(Op::Jump);
+
+        code[branch].b = here();
+        emit(Op::Move, dst, compileExpr(expr.right()));
+        auto endJump2 = emit(Op::Jump);
+
+        // Both sides are evaluated by the tree walker when the predicate
+        // is unknown to avoid duplicating their code.
+        code[branch].c = here();
+        auto savedTemps = curTemps;
+        auto mask = newTemp();
+        emit(Op::Move, mask, cond);
+        auto lhs = delegate(expr.left());
+        auto rhs = delegate(expr.right());
+        code[emit(Op::MergeCond, dst, mask, lhs, rhs)].expr = &expr;
+        curTemps = savedTemps;
+
+        code[endJump1].a = here();
+        code[endJump2].a = here();
+        return dst;
+    }
+
+    std::optional<uint32_t> compileAssignment(const AssignmentExpression& expr) {
+        // Only whole-variable assignments to locals are compiled. Queues are
+        // excluded because storing to them can be limited by their max bound.
+        if (expr.timingControl || expr.left().type->isQueue())
+            return std::nullopt;
+
+        auto slot = findSlot(expr.left());
+        if (!slot)
+            return std::nullopt;
+
+        uint32_t rhs;
+        if (expr.isCompound()) {
+            // The lvalue only needs to be pushed if part of the right hand
+            // side ends up being evaluated by the tree walker. That isn't known
+            // until it has been compiled, so reserve a spot with a jump that
+            // goes nowhere and replace it if needed.
+            auto pushIndex = emit(Op::Jump, 0, here() + 1);
+            lvalueTargets.push_back({*slot});
+            rhs = compileExpr(expr.right());
+
+            if (lvalueTargets.back().needsPush) {
+                code[pushIndex] = {};
+                code[pushIndex].op = Op::PushLValue;
+                code[pushIndex].a = *slot;
+                maxLValues = std::max(maxLValues, ++curLValues);
+                emit(Op::PopLValue);
+                curLValues--;
+            }
+            lvalueTargets.pop_back();
+        }
+        else {
+            rhs = compileExpr(expr.right());
+        }
+
+        emit(Op::Move, *slot, rhs);
+        return *slot;
+    }
+};
+
+} // namespace
+
+namespace slang::ast {
+
+const ConstantBytecode* ConstantBytecode::compile(const SubroutineSymbol& subroutine) {
+    BytecodeCompiler compiler(subroutine);
+    return compiler.compile();
+}
+
+ER ConstantBytecode::run(EvalContext& context) const {
+    SmallVector<ConstantValue*> locals;
+    locals.resize(numLocals, nullptr);
+
+    SmallVector<ConstantValue> temps;
+    temps.resize(numTemps);
+
+    SmallVector<int64_t> counters;
+    counters.resize(numCounters, 0);
+
+    // The lvalue storage must not move while it's on the context's stack.
+    SmallVector<LValue> lvalues;
+    lvalues.reserve(numLValues);
+
+    auto reg = [&](uint32_t r) -> ConstantValue& {
+        if (r & LocalBit)
+            return *locals[r & ~LocalBit];
+        return temps[r];
+    };
+
+    auto take = [&](uint32_t r) -> ConstantValue {
+        if (r & LocalBit)
+            return *locals[r & ~LocalBit];
+        return std::move(temps[r]);
+    };
+
+    auto finish = [&](ER result) {
+        for (size_t i = 0; i < lvalues.size(); i++)
+            context.popLValue();
+        return result;
+    };
+
+    size_t pc = 0;
+    while (true) {
+        auto& inst = instructions[pc++];
+        switch (inst.op) {
+            case Opcode::Step:
+                if (!context.step(inst.stmt->sourceRange.start()))
+                    return finish(ER::Fail);
+                break;
+            case Opcode::LoadConst:
+                if (!*inst.constant)
+                    return finish(ER::Fail);
+                reg(inst.dst) = *inst.constant;
+                break;
+            case Opcode::Move:
+                if (inst.dst != inst.a)
+                    reg(inst.dst) = take(inst.a);
+                break;
+            case Opcode::BindLocal:
+                locals[inst.dst & ~LocalBit] = context.findLocal(inst.symbol);
+                SLANG_ASSERT(locals[inst.dst & ~LocalBit]);
+                break;
+            case Opcode::DeclLocal: {
+                auto& symbol = inst.stmt->as<VariableDeclStatement>().symbol;
+                ConstantValue* storage;
+                if (inst.a == NoReg)
+                    storage = context.createLocal(&symbol);
+                else
+                    storage = context.createLocal(&symbol, take(inst.a));
+                locals[inst.dst & ~LocalBit] = storage;
+                break;
+            }
+            case Opcode::EvalExpr: {
+                auto& dst = reg(inst.dst);
+                dst = inst.expr->eval(context);
+                if (!dst)
+                    return finish(ER::Fail);
+                break;
+            }
+            case Opcode::EvalStmt:
+                switch (inst.stmt->eval(context)) {
+                    case ER::Success:
+                        break;
+                    case ER::Break:
+                        SLANG_ASSERT(inst.a != NoReg);
+                        pc = inst.a;
+                        break;
+                    case ER::Continue:
+                        SLANG_ASSERT(inst.b != NoReg);
+                        pc = inst.b;
+                        break;
+                    case ER::Return:
+                        return finish(ER::Return);
+                    case ER::Disable:
+                        return finish(ER::Disable);
+                    case ER::Fail:
+                        return finish(ER::Fail);
+                }
+                break;
+            case Opcode::Unary: {
+                auto& dst = reg(inst.dst);
+                dst = Expression::evalUnaryOperator(UnaryOperator(inst.subOp), take(inst.a));
+                if (!dst)
+                    return finish(ER::Fail);
+                break;
+            }
+            case Opcode::IncDec: {
+                // This mirrors the integer handling in UnaryExpression::evalImpl.
+                auto& target = reg(inst.a);
+                if (!target)
+                    return finish(ER::Fail);
+
+                SVInt& v = target.integer();
+                ConstantValue result;
+                switch (UnaryOperator(inst.subOp)) {
+                    case UnaryOperator::Preincrement:
+                        result = ++v;
+                        break;
+                    case UnaryOperator::Predecrement:
+                        result = --v;
+                        break;
+                    case UnaryOperator::Postincrement:
+                        result = v;
+                        v = v + 1;
+                        break;
+                    case UnaryOperator::Postdecrement:
+                        result = v;
+                        v = v - 1;
+                        break;
+                    default:
+                        SLANG_UNREACHABLE;
+                }
+
+                if (inst.dst != NoReg)
+                    reg(inst.dst) = std::move(result);
+                break;
+            }
+            case Opcode::Binary: {
+                auto result = Expression::evalBinaryOperator(BinaryOperator(inst.subOp),
+                                                             reg(inst.a), reg(inst.b));
+                if (!result)
+                    return finish(ER::Fail);
+                reg(inst.dst) = std::move(result);
+                break;
+            }
+            case Opcode::ShortCircuit: {
+                // This mirrors the handling in BinaryExpression::evalImpl.
+                auto& lhs = reg(inst.a);
+                std::optional<bool> result;
+                switch (BinaryOperator(inst.subOp)) {
+                    case BinaryOperator::LogicalOr:
+                        if (lhs.isTrue())
+                            result = true;
+                        break;
+                    case BinaryOperator::LogicalAnd:
+                        if (lhs.isFalse())
+                            result = false;
+                        break;
+                    case BinaryOperator::LogicalImplication:
+                        if (lhs.isFalse())
+                            result = true;
+                        break;
+                    default:
+                        SLANG_UNREACHABLE;
+                }
+
+                if (result) {
+                    reg(inst.dst) = SVInt(*result);
+                    pc = inst.b;
+                }
+                break;
+            }
+            case Opcode::Convert: {
+                auto& dst = reg(inst.dst);
+                dst = inst.expr->as<ConversionExpression>().applyTo(context, take(inst.a));
+                if (!dst)
+                    return finish(ER::Fail);
+                break;
+            }
+            case Opcode::Jump:
+                pc = inst.a;
+                break;
+            case Opcode::JumpIfFalse:
+                if (!reg(inst.a).isTrue())
+                    pc = inst.b;
+                break;
+            case Opcode::Branch: {
+                auto& cond = reg(inst.a);
+                if (cond.isInteger() && cond.integer().hasUnknown())
+                    pc = inst.c;
+                else if (!cond.isTrue())
+                    pc = inst.b;
+                break;
+            }
+            case Opcode::MergeCond: {
+                // This mirrors the handling in ConditionalExpression::evalImpl
+                // for integral and floating point types.
+                auto& lhs = reg(inst.b);
+                auto& rhs = reg(inst.c);
+                auto& dst = reg(inst.dst);
+                if (lhs.isInteger() && rhs.isInteger())
+                    dst = SVInt::conditional(reg(inst.a).integer(), lhs.integer(), rhs.integer());
+                else
+                    dst = inst.expr->type->getDefaultValue();
+                break;
+            }
+            case Opcode::RepeatInit: {
+                // This mirrors the handling in RepeatLoopStatement::evalImpl.
+                auto& cv = reg(inst.a);
+                std::optional<int64_t> oc = cv.integer().as<int64_t>();
+                if (!oc || oc < 0) {
+                    if (cv.integer().hasUnknown()) {
+                        oc = 0;
+                    }
+                    else {
+                        auto& diag = context.addDiag(diag::ValueOutOfRange,
+                                                     inst.expr->sourceRange);
+                        diag << cv << 0 << INT64_MAX;
+                        return finish(ER::Fail);
+                    }
+                }
+                counters[inst.dst] = *oc;
+                break;
+            }
+            case Opcode::RepeatNext:
+                if (counters[inst.dst] <= 0)
+                    pc = inst.a;
+                else
+                    counters[inst.dst]--;
+                break;
+            case Opcode::PushLValue:
+                context.pushLValue(lvalues.emplace_back(reg(inst.a)));
+                break;
+            case Opcode::PopLValue:
+                context.popLValue();
+                lvalues.pop_back();
+                break;
+            case Opcode::Return:
+                return finish(ER::Return);
+            case Opcode::Exit:
+                return finish(ER::Success);
+        }
+    }
+}
+
+} // namespace slang::ast
@@ -336,8 +336,11 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             return;
         }
 
-        if (visitInstances)
+        if (visitInstances && !tryShareInstance(symbol)) {
             visit(symbol.body);
+            if (!finishedEarly())
+                addCanonicalInstance(symbol);
+        }
     }
 
     void handle(const SubroutineSymbol& symbol) {
@@ -420,6 +423,126 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         symbol.getPathSource();
     }
 
+    // Instances that have the same definition and parameter values as some
+    // previously elaborated instance don't need to be elaborated again; they
+    // can share the results (and diagnostics) of the first one. This only applies
+    // when nothing about the instance's location in the hierarchy can influence
+    // its contents, which we check here.
+    bool isCacheableInstance(const InstanceSymbol& symbol) const {
+        if (!compilation.hasFlag(CompilationFlags::EnableInstanceCaching) ||
+            symbol.resolvedConfig || symbol.isInterface()) {
+            return false;
+        }
+
+        auto& body = symbol.body;
+        if (body.hierarchyOverrideNode || body.flags.has(InstanceFlags::Uninstantiated))
+            return false;
+
+        return std::ranges::none_of(body.getPortList(), [](const Symbol* port) {
+            return port->kind == SymbolKind::InterfacePort;
+        });
+    }
+
+    bool tryShareInstance(const InstanceSymbol& symbol) {
+        if (!isCacheableInstance(symbol) || symbol.body.isHierarchicalReferenceTarget())
+            return false;
+
+        auto it = instanceCache.find(&symbol.getDefinition());
+        if (it == instanceCache.end())
+            return false;
+
+        for (auto canonical : it->second) {
+            if (!hasNonLocalEffects(*canonical) && canonical->flags == symbol.body.flags &&
+                canonical->hasSameType(symbol.body)) {
+                symbol.setCanonicalBody(canonical);
+                sharedInstances.push_back(&symbol);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Bodies that reach outside of themselves, either through hierarchical
+    // references or by driving symbols declared elsewhere (in a package or
+    // in $unit, for example), have effects that depend on being elaborated
+    // once per instance, so they can't stand in for other instances.
+    static bool hasNonLocalEffects(const InstanceBodySymbol& body) {
+        return body.hasHierarchicalReferences() || body.hasExternalDrivers();
+    }
+
+    void addCanonicalInstance(const InstanceSymbol& symbol) {
+        if (isCacheableInstance(symbol) && !hasNonLocalEffects(symbol.body))
+            instanceCache[&symbol.getDefinition()].push_back(&symbol.body);
+    }
+
+    // Hierarchical references and drivers are resolved lazily, so one that
+    // refers into a shared instance, or out of the body it shares, may only
+    // have been seen after the decision to share was made. Go back and fully elaborate any
+    // such instances. Returns true if anything was visited.
+    bool elaborateInvalidatedInstances() {
+        bool didSomething = false;
+        while (!finishedEarly()) {
+            SmallVector<const InstanceSymbol*> toVisit;
+            std::erase_if(sharedInstances, [&](const InstanceSymbol* symbol) {
+                if (symbol->body.isHierarchicalReferenceTarget() ||
+                    hasNonLocalEffects(*symbol->getCanonicalBody())) {
+                    toVisit.push_back(symbol);
+                    return true;
+                }
+                return false;
+            });
+
+            if (toVisit.empty())
+                break;
+
+            for (auto symbol : toVisit) {
+                symbol->setCanonicalBody(nullptr);
+                visit(symbol->body);
+            }
+            didSomething = true;
+        }
+        return didSomething;
+    }
+
+    // Records on each canonical body the number of instances in the design that
+    // share it. A sharing instance can itself be nested inside shared bodies, in
+    // which case it stands in for each of the instances sharing those parents.
+    void countSharedInstances() {
+        flat_hash_map<const InstanceBodySymbol*, SmallVector<const InstanceSymbol*>> sharers;
+        for (auto symbol : sharedInstances)
+            sharers[symbol->getCanonicalBody()].push_back(symbol);
+
+        auto containingBody = [](const InstanceSymbol& inst) {
+            auto scope = inst.getParentScope();
+            return scope ? scope->getContainingInstance() : nullptr;
+        };
+
+        // Returns the number of instances in the design represented by the given body.
+        flat_hash_map<const InstanceBodySymbol*, size_t> counts;
+        auto getCount = [&](auto&& self, const InstanceBodySymbol* body) -> size_t {
+            if (!body)
+                return 1;
+
+            if (auto it = counts.find(body); it != counts.end())
+                return it->second;
+
+            size_t shared = 0;
+            if (auto it = sharers.find(body); it != sharers.end()) {
+                for (auto sharer : it->second)
+                    shared += self(self, containingBody(*sharer));
+            }
+
+            SLANG_ASSERT(body->parentInstance);
+            body->setNumSharedInstances(shared);
+            auto result = self(self, containingBody(*body->parentInstance)) + shared;
+            counts.emplace(body, result);
+            return result;
+        };
+
+        for (auto& [body, _] : sharers)
+            getCount(getCount, body);
+    }
+
     void finalize() {
         // Once everything has been visited, go back over and check things that might
         // have been influenced by visiting later symbols. Unfortunately visiting
@@ -429,7 +552,7 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
         SmallVector<const Type*> toVisit;
         bool didSomething;
         do {
-            didSomething = false;
+            didSomething = elaborateInvalidatedInstances();
             for (auto symbol : genericClasses) {
                 for (auto& spec : symbol->specializations()) {
                     if (visitedSpecs.emplace(&spec).second)
@@ -452,6 +575,9 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
             if (symbol->numSpecializations() == 0)
                 symbol->getInvalidSpecialization().visit(*this);
         }
+
+        elaborateInvalidatedInstances();
+        countSharedInstances();
     }
 
     Compilation& compilation;
@@ -460,6 +586,9 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
     bool visitInstances = true;
     bool hierarchyProblem = false;
     flat_hash_set<const InstanceBodySymbol*> activeInstanceBodies;
+    flat_hash_map<const DefinitionSymbol*, SmallVector<const InstanceBodySymbol*, 2>>
+        instanceCache;
+    std::vector<const InstanceSymbol*> sharedInstances;
     flat_hash_set<const DefinitionSymbol*> usedIfacePorts;
     SmallVector<const GenericClassDefSymbol*> genericClasses;
     SmallVector<const SubroutineSymbol*> dpiImports;
@@ -468,6 +597,72 @@ struct DiagnosticVisitor : public ASTVisitor<DiagnosticVisitor, false, false> {
     TimingPathMap timingPathMap;
 };
 
+// This visitor is used instead of the DiagnosticVisitor when the compilation
+// is set to only elaborate the hierarchy. It realizes instances, generate blocks,
+// and parameter values but doesn't touch any other members of instance bodies,
+// so statements and expressions are never bound.
+struct HierarchyVisitor : public ASTVisitor<HierarchyVisitor, false, false> {
+    HierarchyVisitor(Compilation& compilation, const size_t& numErrors, uint32_t errorLimit) :
+        compilation(compilation), numErrors(numErrors), errorLimit(errorLimit) {}
+
+    bool finishedEarly() const { return numErrors > errorLimit || hierarchyProblem; }
+
+    void handle(const RootSymbol& symbol) { visitDefault(symbol); }
+    void handle(const CompilationUnitSymbol& symbol) { visitDefault(symbol); }
+    void handle(const ParameterSymbol& symbol) { symbol.getValue(); }
+    void handle(const TypeParameterSymbol& symbol) { symbol.targetType.getType(); }
+
+    void handle(const InstanceSymbol& symbol) {
+        if (finishedEarly())
+            return;
+
+        // Recursive and overly deep hierarchies are detected the same way
+        // as in the DiagnosticVisitor.
+        if (!activeInstanceBodies.emplace(&symbol.body).second) {
+            symbol.getParentScope()->addDiag(diag::InfinitelyRecursiveHierarchy, symbol.location)
+                << symbol.name;
+            hierarchyProblem = true;
+            return;
+        }
+
+        auto guard = ScopeGuard([this, &symbol] { activeInstanceBodies.erase(&symbol.body); });
+        if (activeInstanceBodies.size() > compilation.getOptions().maxInstanceDepth) {
+            auto& diag = symbol.getParentScope()->addDiag(diag::MaxInstanceDepthExceeded,
+                                                          symbol.location);
+            diag << symbol.getDefinition().getKindString();
+            diag << compilation.getOptions().maxInstanceDepth;
+            hierarchyProblem = true;
+            return;
+        }
+
+        visitDefault(symbol.body);
+    }
+
+    void handle(const InstanceArraySymbol& symbol) {
+        if (!finishedEarly())
+            visitDefault(symbol);
+    }
+
+    void handle(const GenerateBlockSymbol& symbol) {
+        if (!symbol.isUninstantiated && !finishedEarly())
+            visitDefault(symbol);
+    }
+
+    void handle(const GenerateBlockArraySymbol& symbol) {
+        if (!finishedEarly())
+            visitDefault(symbol);
+    }
+
+    template<typename T>
+    void handle(const T&) {}
+
+    Compilation& compilation;
+    const size_t& numErrors;
+    uint32_t errorLimit;
+    bool hierarchyProblem = false;
+    flat_hash_set<const InstanceBodySymbol*> activeInstanceBodies;
+};
+
 // This visitor is for finding all defparam directives in the hierarchy.
 // We're given a target generate "level" to reach, where the level is a measure
 // of how deep the design is in terms of nested generate blocks. Once we reach
@@ -587,6 +782,13 @@ struct PostElabVisitor : public ASTVisitor<PostElabVisitor, false, false> {
         }
     }
 
+    void handle(const InstanceSymbol& symbol) {
+        // Instances that share another instance's elaboration never had
+        // their own bodies touched, so there's nothing to check in them.
+        if (!symbol.getCanonicalBody())
+            visitDefault(symbol);
+    }
+
     void handle(const MethodPrototypeSymbol&) {
         // Ignore method prototype arguments, they're not unused.
     }
@@ -110,6 +110,14 @@ bool EvalContext::step(SourceLocation loc) {
     return false;
 }
 
+bool EvalContext::tryAddSteps(uint32_t count) {
+    if (uint64_t(steps) + count >= getCompilation().getOptions().maxConstexprSteps)
+        return false;
+
+    steps += count;
+    return true;
+}
+
 std::string EvalContext::dumpStack() const {
     FormatBuffer buffer;
     int index = 0;
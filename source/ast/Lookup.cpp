@@ -863,6 +863,22 @@ void unwrapResult(const Scope& scope, std::optional<SourceRange> range, LookupRe
         }
     }
 
+    if (result.flags.has(LookupResultFlags::IsHierarchical) &&
+        scope.getCompilation().hasFlag(CompilationFlags::EnableInstanceCaching)) {
+        // Let the instances on both ends of the reference know about it so
+        // that their elaboration won't be shared with other identical instances.
+        if (auto inst = scope.getContainingInstance())
+            inst->noteHierarchicalReference();
+
+        if (result.found->kind == SymbolKind::Instance) {
+            result.found->as<InstanceSymbol>().body.noteHierarchicalReferenceTarget();
+        }
+        else if (auto parent = result.found->getParentScope()) {
+            if (auto inst = parent->getContainingInstance())
+                inst->noteHierarchicalReferenceTarget();
+        }
+    }
+
     if (!range)
         return;
 
@@ -925,8 +925,12 @@ Expression& ConversionExpression::makeImplicit(const ASTContext& context, const
 }
 
 ConstantValue ConversionExpression::evalImpl(EvalContext& context) const {
-    return convert(context, *operand().type, *type, sourceRange, operand().eval(context),
-                   conversionKind, &operand(), implicitOpRange);
+    return applyTo(context, operand().eval(context));
+}
+
+ConstantValue ConversionExpression::applyTo(EvalContext& context, ConstantValue&& value) const {
+    return convert(context, *operand().type, *type, sourceRange, std::move(value), conversionKind,
+                   &operand(), implicitOpRange);
 }
 
 ConstantValue ConversionExpression::convert(EvalContext& context, const Type& from, const Type& to,
@@ -9,6 +9,7 @@
 
 #include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
+#include "slang/ast/ConstantBytecode.h"
 #include "slang/ast/Constraints.h"
 #include "slang/ast/EvalContext.h"
 #include "slang/ast/SystemSubroutine.h"
@@ -709,6 +710,31 @@ Expression& CallExpression::createSystemCall(
     return *expr;
 }
 
+static bool isMemoizableArg(const ConstantValue& value) {
+    // Reals are excluded because distinct values like 0.0 and -0.0 compare equal.
+    if (value.isInteger() || value.isString())
+        return true;
+
+    if (value.isUnpacked())
+        return std::ranges::all_of(value.elements(), isMemoizableArg);
+
+    return false;
+}
+
+static bool canMemoize(const EvalContext& context, const SubroutineSymbol& symbol,
+                       std::span<const ConstantValue> args) {
+    if (context.getCompilation().getOptions().maxConstexprMemo == 0 ||
+        context.flags.has(EvalFlags::IsScript | EvalFlags::CovergroupExpr)) {
+        return false;
+    }
+
+    return std::ranges::all_of(args, isMemoizableArg) && symbol.isMemoizable();
+}
+
+// The evaluation flags that can change the result of a memoizable call.
+static constexpr bitmask<EvalFlags> MemoKeyFlags = EvalFlags::SpecparamsAllowed |
+                                                   EvalFlags::AllowUnboundedPlaceholder;
+
 ConstantValue CallExpression::evalImpl(EvalContext& context) const {
     // If thisClass() is set call eval on it to be sure an error is issued.
     if (thisClass()) {
@@ -736,7 +762,24 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
         args.emplace_back(std::move(v));
     }
 
+    // Calls to memoizable functions always produce the same result for the
+    // same arguments, so reuse a previously computed one if we have it.
+    auto& comp = context.getCompilation();
+    std::optional<Compilation::ConstantCallKey> memoKey;
+    if (canMemoize(context, symbol, args)) {
+        memoKey.emplace(&symbol, (context.flags & MemoKeyFlags).bits(),
+                        ConstantValue::Elements(args.begin(), args.end()));
+
+        // Charge the steps the original call took, so that whether the step limit
+        // is hit doesn't depend on which call happened to be evaluated first.
+        // If the limit would be exceeded, evaluate the call to report it.
+        if (auto memo = comp.findMemoizedCall(*memoKey); memo && context.tryAddSteps(memo->steps))
+            return std::move(memo->result);
+    }
+
     // Push a new stack frame, push argument values as locals.
+    const size_t diagCount = context.getDiagCount();
+    const uint32_t stepCount = context.getSteps();
     if (!context.pushFrame(symbol, sourceRange.start(), lookupLocation))
         return nullptr;
 
@@ -748,7 +791,15 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
     context.createLocal(symbol.returnValVar);
 
     using ER = Statement::EvalResult;
-    ER er = symbol.getBody().eval(context);
+    ER er;
+    const ConstantBytecode* bytecode = nullptr;
+    if (comp.hasFlag(CompilationFlags::ConstexprBytecode))
+        bytecode = symbol.getConstantBytecode();
+
+    if (bytecode)
+        er = bytecode->run(context);
+    else
+        er = symbol.getBody().eval(context);
 
     // If we got a disable result, it means a disable statement was evaluated that
     // targeted a block that wasn't executing. This isn't allowed in a constant expression.
@@ -763,6 +814,12 @@ ConstantValue CallExpression::evalImpl(EvalContext& context) const {
         return nullptr;
 
     SLANG_ASSERT(er == ER::Success || er == ER::Return);
+
+    // Only remember results that didn't produce any diagnostics,
+    // since those would be lost on later calls.
+    if (memoKey && result && context.getDiagCount() == diagCount)
+        comp.memoizeCall(std::move(*memoKey), {result, context.getSteps() - stepCount});
+
     return result;
 }
 
@@ -541,7 +541,10 @@ ConstantValue UnaryExpression::evalImpl(EvalContext& context) const {
         SLANG_UNREACHABLE;
     }
 
-    ConstantValue cv = operand().eval(context);
+    return evalUnaryOperator(op, operand().eval(context));
+}
+
+ConstantValue Expression::evalUnaryOperator(UnaryOperator op, ConstantValue&& cv) {
     if (!cv)
         return nullptr;
 
@@ -1126,6 +1126,32 @@ bool InstanceBodySymbol::hasSameType(const InstanceBodySymbol& other) const {
     return true;
 }
 
+template<typename TFunc>
+static void forEachInstanceUpward(const InstanceBodySymbol& body, TFunc&& func) {
+    auto curr = &body;
+    while (curr) {
+        func(*curr);
+        if (!curr->parentInstance)
+            break;
+
+        auto scope = curr->parentInstance->getParentScope();
+        curr = scope ? scope->getContainingInstance() : nullptr;
+    }
+}
+
+void InstanceBodySymbol::noteHierarchicalReference() const {
+    forEachInstanceUpward(*this, [](const InstanceBodySymbol& body) { body.hasHierRefs = true; });
+}
+
+void InstanceBodySymbol::noteHierarchicalReferenceTarget() const {
+    forEachInstanceUpward(*this,
+                          [](const InstanceBodySymbol& body) { body.isHierRefTarget = true; });
+}
+
+void InstanceBodySymbol::noteExternalDriver() const {
+    forEachInstanceUpward(*this, [](const InstanceBodySymbol& body) { body.hasExtDrivers = true; });
+}
+
 void InstanceBodySymbol::serializeTo(ASTSerializer& serializer) const {
     serializer.writeLink("definition", definition);
 }
@@ -10,6 +10,7 @@
 #include "slang/ast/ASTSerializer.h"
 #include "slang/ast/ASTVisitor.h"
 #include "slang/ast/Compilation.h"
+#include "slang/ast/ConstantBytecode.h"
 #include "slang/ast/expressions/MiscExpressions.h"
 #include "slang/ast/symbols/ClassSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
@@ -734,6 +735,107 @@ bitmask<MethodFlags> SubroutineSymbol::buildArguments(
     return resultFlags;
 }
 
+const ConstantBytecode* SubroutineSymbol::getConstantBytecode() const {
+    if (!bytecode.has_value()) {
+        // Calls evaluated while the body is still being bound
+        // have to go through the tree walker.
+        getBody();
+        if (isConstructing)
+            return nullptr;
+
+        bytecode = ConstantBytecode::compile(*this);
+    }
+    return *bytecode;
+}
+
+namespace {
+
+struct MemoizableVisitor : public ASTVisitor<MemoizableVisitor, true, true> {
+    const SubroutineSymbol& subroutine;
+    bool result = true;
+
+    explicit MemoizableVisitor(const SubroutineSymbol& subroutine) : subroutine(subroutine) {}
+
+    void handle(const NamedValueExpression& expr) {
+        if (!isLocalOrConstant(expr.symbol))
+            result = false;
+    }
+
+    void handle(const HierarchicalValueExpression&) { result = false; }
+    void handle(const ArbitrarySymbolExpression&) { result = false; }
+
+    void handle(const CallExpression& expr) {
+        if (expr.thisClass()) {
+            result = false;
+        }
+        else if (expr.isSystemCall()) {
+            if (expr.getSubroutineKind() == SubroutineKind::Task)
+                result = false;
+        }
+        else {
+            // Direct recursion is fine; anything else has to be memoizable itself.
+            auto& callee = *std::get<0>(expr.subroutine);
+            if (&callee != &subroutine && !callee.isMemoizable())
+                result = false;
+        }
+
+        if (result)
+            visitDefault(expr);
+    }
+
+    bool isLocalOrConstant(const Symbol& symbol) const {
+        switch (symbol.kind) {
+            case SymbolKind::Parameter:
+            case SymbolKind::EnumValue:
+            case SymbolKind::Specparam:
+                return true;
+            default:
+                break;
+        }
+
+        auto scope = symbol.getParentScope();
+        while (scope) {
+            auto& parent = scope->asSymbol();
+            if (&parent == &subroutine)
+                return true;
+
+            if (parent.kind != SymbolKind::StatementBlock)
+                return false;
+
+            scope = parent.getParentScope();
+        }
+        return false;
+    }
+};
+
+} // namespace
+
+bool SubroutineSymbol::isMemoizable() const {
+    if (!cachedIsMemoizable.has_value()) {
+        // Calls evaluated while the body is still being bound can't be checked yet.
+        auto& body = getBody();
+        if (isConstructing)
+            return false;
+
+        // Mark as not memoizable while we're checking so that mutual
+        // recursion conservatively resolves to false.
+        cachedIsMemoizable = false;
+
+        const auto excludedFlags = MethodFlags::DPIImport | MethodFlags::InterfaceExtern |
+                                   MethodFlags::ModportImport | MethodFlags::ModportExport |
+                                   MethodFlags::BuiltIn | MethodFlags::Randomize;
+        if (subroutineKind != SubroutineKind::Function || flags.has(excludedFlags) || thisVar ||
+            hasOutputArgs() || body.bad()) {
+            return false;
+        }
+
+        MemoizableVisitor visitor(*this);
+        body.visit(visitor);
+        cachedIsMemoizable = visitor.result;
+    }
+    return *cachedIsMemoizable;
+}
+
 bool SubroutineSymbol::hasOutputArgs() const {
     if (!cachedHasOutputArgs.has_value()) {
         cachedHasOutputArgs = false;
@@ -15,6 +15,7 @@
 #include "slang/ast/expressions/MiscExpressions.h"
 #include "slang/ast/expressions/SelectExpressions.h"
 #include "slang/ast/symbols/BlockSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/ast/symbols/VariableSymbols.h"
 #include "slang/ast/types/NetType.h"
 #include "slang/ast/types/Type.h"
@@ -218,11 +219,39 @@ void ValueSymbol::addDriver(DriverKind driverKind, DriverBitRange bounds,
     addDriver(bounds, *driver);
 }
 
+// Instances that drive a symbol declared outside of themselves can't share
+// their elaboration with other instances, since each one adds its own driver.
+static void checkExternalDriver(const Scope& scope, const ValueDriver& driver) {
+    auto& containing = *driver.containingSymbol;
+    const InstanceBodySymbol* driverBody = nullptr;
+    if (containing.kind == SymbolKind::InstanceBody)
+        driverBody = &containing.as<InstanceBodySymbol>();
+    else if (auto parent = containing.getParentScope())
+        driverBody = parent->getContainingInstance();
+
+    if (!driverBody)
+        return;
+
+    // The driver is local if the symbol lives in the driving body or one of its children.
+    auto curr = scope.getContainingInstance();
+    while (curr) {
+        if (curr == driverBody)
+            return;
+
+        auto instScope = curr->parentInstance ? curr->parentInstance->getParentScope() : nullptr;
+        curr = instScope ? instScope->getContainingInstance() : nullptr;
+    }
+
+    driverBody->noteExternalDriver();
+}
+
 void ValueSymbol::addDriver(DriverBitRange bounds, const ValueDriver& driver) const {
     auto scope = getParentScope();
     SLANG_ASSERT(scope);
 
     auto& comp = scope->getCompilation();
+    if (comp.hasFlag(CompilationFlags::EnableInstanceCaching))
+        checkExternalDriver(*scope, driver);
 
     if (driverMap.empty()) {
         // The first time we add a driver, check whether there is also an
@@ -98,6 +98,17 @@ void Driver::addStandardArgs() {
     cmdLine.add("--ignore-directive", options.ignoreDirectives,
                 "Ignore preprocessor directive and all its arguments until EOL", "<directive>",
                 CommandLineFlags::CommaList);
+    cmdLine.add("--prefix-header", options.prefixHeaders,
+                "Preprocess the given headers once and make the macros they define available "
+                "in every compilation unit",
+                "<file>[,...]", CommandLineFlags::CommaList);
+    cmdLine.add("--save-pp-snapshot", options.savePPSnapshot,
+                "Save the preprocessor state built from --prefix-header files to <file>",
+                "<file>");
+    cmdLine.add("--load-pp-snapshot", options.loadPPSnapshot,
+                "Restore preprocessor state saved by --save-pp-snapshot at the start of every "
+                "compilation unit",
+                "<file>");
 
     // Parsing
     cmdLine.add("--max-parse-depth", options.maxParseDepth,
@@ -107,7 +118,9 @@ void Driver::addStandardArgs() {
                 "is skipped",
                 "<count>");
     cmdLine.add("-j,--threads", options.numThreads,
-                "The number of threads to use to parallelize parsing", "<count>");
+                "The number of threads to use to parallelize parsing (elaboration is always "
+                "single threaded)",
+                "<count>");
 
     cmdLine.add(
         "-C",
@@ -137,6 +150,10 @@ void Driver::addStandardArgs() {
                 "Maximum number of frames to show when printing a constant evaluation "
                 "backtrace; the rest will be abbreviated",
                 "<limit>");
+    cmdLine.add("--max-constexpr-memo", options.maxConstexprMemo,
+                "Maximum number of results of pure constant function calls to remember "
+                "for reuse; zero (the default) disables memoization",
+                "<entries>");
     cmdLine.add("--max-instance-array", options.maxInstanceArray,
                 "Maximum number of instances allowed in a single instance array", "<limit>");
     cmdLine.add("--compat", options.compat,
@@ -185,6 +202,12 @@ void Driver::addStandardArgs() {
     addCompFlag(CompilationFlags::StrictDriverChecking, "--strict-driver-checking",
                 "Perform strict driver checking, which currently means disabling "
                 "procedural 'for' loop unrolling.");
+    addCompFlag(CompilationFlags::EnableInstanceCaching, "--enable-instance-caching",
+                "Elaborate only one of each set of instances that have identical "
+                "definitions and parameter values, and share its results with the others");
+    addCompFlag(CompilationFlags::ConstexprBytecode, "--constexpr-bytecode",
+                "Compile constant functions to bytecode instead of interpreting "
+                "their syntax trees on every call");
     addCompFlag(CompilationFlags::LintMode, "--lint-only",
                 "Only perform linting of code, don't try to elaborate a full hierarchy");
 
@@ -252,6 +275,12 @@ void Driver::addStandardArgs() {
     cmdLine.add("--single-unit", options.singleUnit,
                 "Treat all input files as a single compilation unit");
 
+    cmdLine.add("--mmap-files", options.memoryMapFiles,
+                "Memory map source files instead of copying them into memory when loading");
+
+    cmdLine.add("--huge-pages", options.hugePages,
+                "Back large internal memory allocations with huge pages, where supported");
+
     cmdLine.add(
         "-v,--libfile",
         [this](std::string_view value) {
@@ -470,6 +499,16 @@ bool Driver::processOptions() {
         return false;
     }
 
+    if (options.savePPSnapshot.has_value() && options.prefixHeaders.empty()) {
+        printError("--prefix-header must be set when --save-pp-snapshot is used");
+        return false;
+    }
+
+    if (options.loadPPSnapshot.has_value() && !options.prefixHeaders.empty()) {
+        printError("--load-pp-snapshot cannot be used with --prefix-header");
+        return false;
+    }
+
     if (options.librariesInheritMacros == true && !options.singleUnit.value_or(false)) {
         printError("--single-unit must be set when --libraries-inherit-macros is used");
         return false;
@@ -489,11 +528,17 @@ bool Driver::processOptions() {
     if (!reportLoadErrors())
         return false;
 
+    if (options.memoryMapFiles == true)
+        sourceManager.setMemoryMapFiles(true);
+
     if (!sourceLoader.hasFiles()) {
         printError("no input files");
         return false;
     }
 
+    if (!preparePPSnapshot())
+        return false;
+
     auto& dc = *diagClient;
     dc.showColors(showColors);
     dc.showColumn(options.diagColumn.value_or(true));
@@ -701,6 +746,7 @@ void Driver::addParseOptions(Bag& bag) const {
         ppoptions.maxIncludeDepth = *options.maxIncludeDepth;
     for (const auto& d : options.ignoreDirectives)
         ppoptions.ignoreDirectives.emplace(d);
+    ppoptions.snapshot = ppSnapshot;
 
     LexerOptions loptions;
     loptions.languageVersion = languageVersion;
@@ -712,10 +758,19 @@ void Driver::addParseOptions(Bag& bag) const {
     if (options.maxParseDepth.has_value())
         poptions.maxRecursionDepth = *options.maxParseDepth;
 
+    BumpAllocatorOptions aoptions;
+    if (options.hugePages == true) {
+        // Segments need to be able to grow to at least the size of a huge page
+        // for the OS to be able to back them with one.
+        aoptions.useHugePages = true;
+        aoptions.maxSegmentSize = std::max(aoptions.maxSegmentSize, size_t(2 * 1024 * 1024));
+    }
+
     bag.set(soptions);
     bag.set(ppoptions);
     bag.set(loptions);
     bag.set(poptions);
+    bag.set(aoptions);
 }
 
 void Driver::addCompilationOptions(Bag& bag) const {
@@ -732,6 +787,8 @@ void Driver::addCompilationOptions(Bag& bag) const {
         coptions.maxConstexprSteps = *options.maxConstexprSteps;
     if (options.maxConstexprBacktrace.has_value())
         coptions.maxConstexprBacktrace = *options.maxConstexprBacktrace;
+    if (options.maxConstexprMemo.has_value())
+        coptions.maxConstexprMemo = *options.maxConstexprMemo;
     if (options.maxInstanceArray.has_value())
         coptions.maxInstanceArray = *options.maxInstanceArray;
     if (options.errorLimit.has_value())
@@ -787,7 +844,7 @@ std::unique_ptr<Compilation> Driver::createCompilation() {
 }
 
 bool Driver::reportParseDiags() {
-    Diagnostics diags;
+    Diagnostics diags = ppSnapshotDiags;
     for (auto& tree : sourceLoader.getLibraryMaps())
         diags.append_range(tree->diagnostics());
     for (auto& tree : syntaxTrees)
@@ -913,6 +970,57 @@ bool Driver::reportLoadErrors() {
     return true;
 }
 
+bool Driver::preparePPSnapshot() {
+    if (options.prefixHeaders.empty() && !options.loadPPSnapshot.has_value())
+        return true;
+
+    // Any diagnostics get reported along with the rest of the parse diagnostics.
+    Bag optionBag;
+    addParseOptions(optionBag);
+
+    if (options.loadPPSnapshot.has_value()) {
+        auto buffer = sourceManager.readSource(*options.loadPPSnapshot, /* library */ nullptr);
+        if (!buffer) {
+            printError(fmt::format("unable to read preprocessor snapshot '{}': {}",
+                                   *options.loadPPSnapshot, buffer.error().message()));
+            return false;
+        }
+
+        ppSnapshot = PreprocessorSnapshot::deserialize(sourceManager, *buffer, ppSnapshotDiags,
+                                                       optionBag);
+        return true;
+    }
+
+    std::vector<SourceBuffer> buffers;
+    for (auto& path : options.prefixHeaders) {
+        auto buffer = sourceManager.readSource(path, /* library */ nullptr);
+        if (!buffer) {
+            printError(fmt::format("unable to read prefix header '{}': {}", path,
+                                   buffer.error().message()));
+            return false;
+        }
+        buffers.push_back(*buffer);
+    }
+
+    auto snapshot = PreprocessorSnapshot::fromBuffers(sourceManager, buffers, ppSnapshotDiags,
+                                                      optionBag);
+    if (options.savePPSnapshot.has_value()) {
+        SLANG_TRY {
+            OS::writeFile(*options.savePPSnapshot, snapshot->serialize());
+        }
+        SLANG_CATCH(const std::exception& e) {
+#if __cpp_exceptions
+            printError(fmt::format("unable to write preprocessor snapshot '{}': {}",
+                                   *options.savePPSnapshot, e.what()));
+#endif
+            return false;
+        }
+    }
+
+    ppSnapshot = std::move(snapshot);
+    return true;
+}
+
 void Driver::printError(const std::string& message) {
     OS::printE(fg(diagClient->errorColor), "error: ");
     OS::printE(message);
@@ -15,6 +15,7 @@
 #include "slang/text/SourceManager.h"
 #include "slang/util/String.h"
 #include "slang/util/ThreadPool.h"
+#include "slang/util/TimeTrace.h"
 
 namespace fs = std::filesystem;
 
@@ -22,6 +23,52 @@ namespace slang::driver {
 
 using namespace syntax;
 
+namespace {
+
+// Tracks how long each thread spends running tasks during a parallel phase
+// so that the balance of work can be reported when time tracing is enabled.
+class BusyTimeTracker {
+public:
+    explicit BusyTimeTracker(std::string_view name) :
+        name(name), enabled(TimeTrace::isEnabled()), start(std::chrono::steady_clock::now()) {}
+
+    template<typename TFunc>
+    void run(TFunc&& func) {
+        if (!enabled) {
+            func();
+            return;
+        }
+
+        auto taskStart = std::chrono::steady_clock::now();
+        func();
+        auto elapsed = std::chrono::steady_clock::now() - taskStart;
+
+        std::scoped_lock lock(mutex);
+        auto& [busy, count] = threadTimes[std::this_thread::get_id()];
+        busy += elapsed;
+        count++;
+    }
+
+    void report() {
+        std::scoped_lock lock(mutex);
+        for (auto& [id, times] : threadTimes) {
+            auto& [busy, count] = times;
+            TimeTrace::addSection(name, fmt::format("{} tasks", count), id, start, busy);
+        }
+        threadTimes.clear();
+    }
+
+private:
+    std::string_view name;
+    bool enabled;
+    std::chrono::steady_clock::time_point start;
+    std::mutex mutex;
+    flat_hash_map<std::thread::id, std::pair<std::chrono::steady_clock::duration, size_t>>
+        threadTimes;
+};
+
+} // namespace
+
 SourceLoader::SourceLoader(SourceManager& sourceManager) : sourceManager(sourceManager) {
     // When searching for library modules we will always include these extensions
     // in addition to anything the user provides.
@@ -247,12 +294,29 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
         loadResults.resize(fileEntries.size());
 
         // Load all source files that were specified on the command line
-        // or via library maps.
-        threadPool.pushLoop(size_t(0), fileEntries.size(), [&](size_t start, size_t end) {
-            for (size_t i = start; i < end; i++)
-                loadResults[i] = loadAndParse(fileEntries[i], optionBag, srcOptions, i);
+        // or via library maps. Files are scheduled largest first, one task
+        // each, so that a few huge files don't end up serialized behind each
+        // other; results are still stored in the original order.
+        auto fileOrder = orderByCost(std::span(fileEntries), [](const FileEntry& entry) {
+            std::error_code ec;
+            auto size = fs::file_size(entry.path, ec);
+            return ec ? uint64_t(0) : uint64_t(size);
         });
+
+        BusyTimeTracker fileBusyTimes("parse worker busy"sv);
+        threadPool.pushLoop(
+            size_t(0), fileOrder.size(),
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; i++) {
+                    fileBusyTimes.run([&, index = fileOrder[i]] {
+                        loadResults[index] = loadAndParse(fileEntries[index], optionBag,
+                                                          srcOptions, index);
+                    });
+                }
+            },
+            fileOrder.size());
         threadPool.waitForAll();
+        fileBusyTimes.report();
 
         for (auto&& result : loadResults)
             handleLoadResult(std::move(result));
@@ -269,13 +333,28 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             const size_t numTrees = syntaxTrees.size();
             syntaxTrees.resize(numTrees + unitList.size());
 
-            threadPool.pushLoop(size_t(0), unitList.size(), [&](size_t start, size_t end) {
-                for (size_t i = start; i < end; i++) {
-                    syntaxTrees[i + numTrees] = parseSeparateUnit(*unitList[i]->first,
-                                                                  unitList[i]->second);
-                }
+            // Units are scheduled by the total size of their buffers.
+            auto unitOrder = orderByCost(std::span(unitList), [](auto unit) {
+                uint64_t size = 0;
+                for (auto& buffer : unit->second)
+                    size += buffer.data.size();
+                return size;
             });
+
+            BusyTimeTracker unitBusyTimes("unit parse worker busy"sv);
+            threadPool.pushLoop(
+                size_t(0), unitOrder.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        unitBusyTimes.run([&, index = unitOrder[i]] {
+                            syntaxTrees[index + numTrees] = parseSeparateUnit(
+                                *unitList[index]->first, unitList[index]->second);
+                        });
+                    }
+                },
+                unitOrder.size());
             threadPool.waitForAll();
+            unitBusyTimes.report();
         }
 
         // If we deferred libraries due to wanting to inherit macros, parse them now.
@@ -283,17 +362,28 @@ SourceLoader::SyntaxTreeList SourceLoader::loadAndParseSources(const Bag& option
             const size_t numTrees = syntaxTrees.size();
             syntaxTrees.resize(numTrees + deferredLibBuffers.size());
 
-            threadPool.pushLoop(size_t(0), deferredLibBuffers.size(),
-                                [&](size_t start, size_t end) {
-                                    for (size_t i = start; i < end; i++) {
-                                        auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[i],
-                                                                           sourceManager, optionBag,
-                                                                           inheritedMacros);
-                                        tree->isLibraryUnit = true;
-                                        syntaxTrees[i + numTrees] = std::move(tree);
-                                    }
-                                });
+            auto libOrder = orderByCost(std::span(deferredLibBuffers),
+                                        [](const SourceBuffer& buffer) {
+                                            return uint64_t(buffer.data.size());
+                                        });
+
+            BusyTimeTracker libBusyTimes("library parse worker busy"sv);
+            threadPool.pushLoop(
+                size_t(0), libOrder.size(),
+                [&](size_t start, size_t end) {
+                    for (size_t i = start; i < end; i++) {
+                        libBusyTimes.run([&, index = libOrder[i]] {
+                            auto tree = SyntaxTree::fromBuffer(deferredLibBuffers[index],
+                                                               sourceManager, optionBag,
+                                                               inheritedMacros);
+                            tree->isLibraryUnit = true;
+                            syntaxTrees[index + numTrees] = std::move(tree);
+                        });
+                    }
+                },
+                libOrder.size());
             threadPool.waitForAll();
+            libBusyTimes.report();
         }
     }
     else {
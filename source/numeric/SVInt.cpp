@@ -517,7 +517,7 @@ SVInt SVInt::shl(const SVInt& rhs) const {
     return shl(rhs.unsignedAmount());
 }
 
-SVInt SVInt::shl(bitwidth_t amount) const {
+SVInt SVInt::shlSlowCase(bitwidth_t amount) const {
     // handle trivial cases
     if (amount == 0)
         return *this;
@@ -529,11 +529,7 @@ SVInt SVInt::shl(bitwidth_t amount) const {
     // handle the small shift case
     SVInt result = allocUninitialized(bitWidth, signFlag, unknownFlag);
     if (amount < BITS_PER_WORD && !unknownFlag) {
-        uint64_t carry = 0;
-        for (uint32_t i = 0; i < getNumWords(); i++) {
-            result.pVal[i] = pVal[i] << amount | carry;
-            carry = pVal[i] >> (BITS_PER_WORD - amount);
-        }
+        shlNear(result.pVal, pVal, getNumWords(), amount);
     }
     else {
         // otherwise do a full shift
@@ -560,7 +556,7 @@ SVInt SVInt::lshr(const SVInt& rhs) const {
     return lshr(rhs.unsignedAmount());
 }
 
-SVInt SVInt::lshr(bitwidth_t amount) const {
+SVInt SVInt::lshrSlowCase(bitwidth_t amount) const {
     // handle trivial cases
     if (amount == 0)
         return *this;
@@ -598,7 +594,7 @@ SVInt SVInt::ashr(const SVInt& rhs) const {
     return ashr(rhs.unsignedAmount());
 }
 
-SVInt SVInt::ashr(bitwidth_t amount) const {
+SVInt SVInt::ashrSlowCase(bitwidth_t amount) const {
     if (amount == 0)
         return *this;
 
@@ -777,18 +773,21 @@ void SVInt::writeTo(SmallVectorBase<char>& buffer, LiteralBase base, bool includ
                 tmp = quotient;
             }
 
-            // repeatedly divide by 10 to get each digit
-            SVInt divisor(4, 10, false);
-            while (tmp != 0) {
-                SVInt remainder;
-                SVInt quotient;
-                divide(tmp, tmp.getNumWords(), divisor, divisor.getNumWords(), &quotient,
-                       &remainder);
-                uint64_t digit = remainder.as<uint64_t>().value();
-                SLANG_ASSERT(digit < 10);
-                buffer.push_back(Digits[digit]);
-                tmp = quotient;
+            // Huge values get split up recursively by powers of ten,
+            // so build up the list of those that could be needed.
+            SmallVector<SVInt> powers;
+            bitwidth_t valueBits = tmp.getActiveBits();
+            if (valueBits > DecimalSplitThreshold) {
+                SVInt power(64, 1000000000, false);
+                while (power.getActiveBits() * 2 <= valueBits + 1) {
+                    powers.push_back(power);
+                    SVInt wide = power.zext(power.getBitWidth() * 2);
+                    power = wide * wide;
+                }
             }
+
+            if (tmp != 0)
+                writeDecimalDigits(buffer, tmp, powers, 0);
         }
     }
     else {
@@ -1139,20 +1138,23 @@ SVInt& SVInt::operator&=(const SVInt& rhs) {
                 pVal[0] = ~pVal[1] & pVal[0] & rhs.val;
             }
             else {
+                // Compute the unknown and value words together in a single pass.
                 if (rhs.hasUnknown()) {
                     for (uint32_t i = 0; i < words; i++) {
-                        pVal[i + words] = (pVal[i + words] | rhs.pVal[i + words]) &
-                                          (pVal[i + words] | pVal[i]) &
-                                          (rhs.pVal[i + words] | rhs.pVal[i]);
+                        uint64_t unknown = (pVal[i + words] | rhs.pVal[i + words]) &
+                                           (pVal[i + words] | pVal[i]) &
+                                           (rhs.pVal[i + words] | rhs.pVal[i]);
+                        pVal[i + words] = unknown;
+                        pVal[i] = ~unknown & pVal[i] & rhs.pVal[i];
                     }
                 }
                 else {
-                    for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] &= rhs.pVal[i];
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unknown = pVal[i + words] & rhs.pVal[i];
+                        pVal[i + words] = unknown;
+                        pVal[i] = ~unknown & pVal[i] & rhs.pVal[i];
+                    }
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & pVal[i] & rhs.pVal[i];
             }
         }
         else {
@@ -1187,19 +1189,23 @@ SVInt& SVInt::operator|=(const SVInt& rhs) {
                 pVal[0] = ~pVal[1] & (pVal[0] | rhs.val);
             }
             else {
+                // Compute the unknown and value words together in a single pass.
                 if (rhs.hasUnknown()) {
                     for (uint32_t i = 0; i < words; i++) {
-                        pVal[i + words] = (pVal[i + words] & (rhs.pVal[i + words] | ~rhs.pVal[i])) |
-                                          (~pVal[i] & rhs.pVal[i + words]);
+                        uint64_t unknown = (pVal[i + words] &
+                                            (rhs.pVal[i + words] | ~rhs.pVal[i])) |
+                                           (~pVal[i] & rhs.pVal[i + words]);
+                        pVal[i + words] = unknown;
+                        pVal[i] = ~unknown & (pVal[i] | rhs.pVal[i]);
                     }
                 }
                 else {
-                    for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] &= ~rhs.pVal[i];
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unknown = pVal[i + words] & ~rhs.pVal[i];
+                        pVal[i + words] = unknown;
+                        pVal[i] = ~unknown & (pVal[i] | rhs.pVal[i]);
+                    }
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & (pVal[i] | rhs.pVal[i]);
             }
         }
         else {
@@ -1232,13 +1238,18 @@ SVInt& SVInt::operator^=(const SVInt& rhs) {
             if (rhs.isSingleWord())
                 pVal[0] = ~pVal[1] & (pVal[0] ^ rhs.val);
             else {
+                // Compute the unknown and value words together in a single pass.
                 if (rhs.hasUnknown()) {
+                    for (uint32_t i = 0; i < words; i++) {
+                        uint64_t unknown = pVal[i + words] | rhs.pVal[i + words];
+                        pVal[i + words] = unknown;
+                        pVal[i] = ~unknown & (pVal[i] ^ rhs.pVal[i]);
+                    }
+                }
+                else {
                     for (uint32_t i = 0; i < words; i++)
-                        pVal[i + words] |= rhs.pVal[i + words];
+                        pVal[i] = ~pVal[i + words] & (pVal[i] ^ rhs.pVal[i]);
                 }
-
-                for (uint32_t i = 0; i < words; i++)
-                    pVal[i] = ~pVal[i + words] & (pVal[i] ^ rhs.pVal[i]);
             }
         }
         else {
@@ -1289,24 +1300,6 @@ SVInt SVInt::xnor(const SVInt& rhs) const {
     return result;
 }
 
-SVInt SVInt::operator+(const SVInt& rhs) const {
-    SVInt tmp(*this);
-    tmp += rhs;
-    return tmp;
-}
-
-SVInt SVInt::operator-(const SVInt& rhs) const {
-    SVInt tmp(*this);
-    tmp -= rhs;
-    return tmp;
-}
-
-SVInt SVInt::operator*(const SVInt& rhs) const {
-    SVInt tmp(*this);
-    tmp *= rhs;
-    return tmp;
-}
-
 SVInt SVInt::operator/(const SVInt& rhs) const {
     bool bothSigned = signFlag && rhs.signFlag;
     if (bitWidth != rhs.bitWidth) {
@@ -1365,25 +1358,45 @@ SVInt SVInt::operator%(const SVInt& rhs) const {
     return urem(*this, rhs, false);
 }
 
-SVInt SVInt::operator&(const SVInt& rhs) const {
+SVInt SVInt::andSlowCase(const SVInt& rhs) const {
+    // Wide, fully known values of the same width can be computed directly
+    // into the result without copying one of the operands first.
+    if (bitWidth == rhs.bitWidth && !unknownFlag && !rhs.unknownFlag) {
+        SVInt result = allocUninitialized(bitWidth, signFlag, false);
+        andWords(result.pVal, pVal, rhs.pVal, getNumWords());
+        return result;
+    }
+
     SVInt tmp(*this);
     tmp &= rhs;
     return tmp;
 }
 
-SVInt SVInt::operator|(const SVInt& rhs) const {
+SVInt SVInt::orSlowCase(const SVInt& rhs) const {
+    if (bitWidth == rhs.bitWidth && !unknownFlag && !rhs.unknownFlag) {
+        SVInt result = allocUninitialized(bitWidth, signFlag, false);
+        orWords(result.pVal, pVal, rhs.pVal, getNumWords());
+        return result;
+    }
+
     SVInt tmp(*this);
     tmp |= rhs;
     return tmp;
 }
 
-SVInt SVInt::operator^(const SVInt& rhs) const {
+SVInt SVInt::xorSlowCase(const SVInt& rhs) const {
+    if (bitWidth == rhs.bitWidth && !unknownFlag && !rhs.unknownFlag) {
+        SVInt result = allocUninitialized(bitWidth, signFlag, false);
+        xorWords(result.pVal, pVal, rhs.pVal, getNumWords());
+        return result;
+    }
+
     SVInt tmp(*this);
     tmp ^= rhs;
     return tmp;
 }
 
-logic_t SVInt::operator<(const SVInt& rhs) const {
+logic_t SVInt::lessThanSlowCase(const SVInt& rhs) const {
     if (unknownFlag || rhs.hasUnknown())
         return logic_t::x;
 
@@ -1447,7 +1460,7 @@ logic_t SVInt::operator[](int32_t index) const {
     return bit ? logic_t::z : logic_t::x;
 }
 
-SVInt SVInt::slice(int32_t msb, int32_t lsb) const {
+SVInt SVInt::sliceSlowCase(int32_t msb, int32_t lsb) const {
     SLANG_ASSERT(msb >= lsb);
 
     // handle indexing out of bounds
@@ -1716,14 +1729,11 @@ SVInt SVInt::conditional(const SVInt& condition, const SVInt& lhs, const SVInt&
     SVInt result = SVInt::allocUninitialized(lhs.bitWidth, bothSigned, true);
     uint32_t words = getNumWords(lhs.bitWidth, false);
 
-    for (uint32_t i = 0; i < words; i++) {
-        // Unknown if either bit is unknown or bits differ.
-        const uint64_t* lp = lhs.getRawData();
-        const uint64_t* rp = rhs.getRawData();
-        result.pVal[i + words] = (lhs.unknownFlag ? lp[i + words] : 0) |
-                                 (rhs.unknownFlag ? rp[i + words] : 0) | (lp[i] ^ rp[i]);
-        result.pVal[i] = ~result.pVal[i + words] & lp[i] & rp[i];
-    }
+    // Bits are unknown if either input bit is unknown or the bits differ.
+    const uint64_t* lp = lhs.getRawData();
+    const uint64_t* rp = rhs.getRawData();
+    mergeUnknownWords(result.pVal, lp, lhs.unknownFlag ? lp + words : nullptr, rp,
+                      rhs.unknownFlag ? rp + words : nullptr, words);
 
     result.clearUnusedBits();
     return result;
@@ -2187,6 +2197,14 @@ void SVInt::divide(const SVInt& lhs, uint32_t lhsWords, const SVInt& rhs, uint32
     buildDivideResult(remainder, r, rhs.bitWidth, bothSigned, rhsWords);
 }
 
+// Checks whether a division is big enough for the recursive algorithm to pay off,
+// based on the number of active bits in the operands. The divisor and the quotient
+// both need to be large; otherwise Knuth's algorithm is already close to linear.
+static bool useRecursiveDivide(bitwidth_t lhsBits, bitwidth_t rhsBits) {
+    constexpr bitwidth_t thresholdBits = RecursiveDivideThreshold * SVInt::BITS_PER_WORD;
+    return rhsBits >= thresholdBits && lhsBits > rhsBits + thresholdBits;
+}
+
 SVInt SVInt::udiv(const SVInt& lhs, const SVInt& rhs, bool bothSigned) {
     // At this point we have two values with the same bit widths, both positive,
     // and X's have been dealt with. Also, we know rhs isn't zero.
@@ -2211,8 +2229,16 @@ SVInt SVInt::udiv(const SVInt& lhs, const SVInt& rhs, bool bothSigned) {
     if (lhsWords == 1 && rhsWords == 1)
         return SVInt(lhs.bitWidth, lhs.pVal[0] / rhs.pVal[0], bothSigned);
 
-    // compute it the hard way with the Knuth algorithm
+    // very wide values with a wide quotient use recursive division
     SVInt quotient;
+    if (useRecursiveDivide(lhsBits, rhsBits)) {
+        SVInt remainder;
+        divideRecursive(lhs, rhs, quotient, remainder);
+        quotient.setSigned(bothSigned);
+        return quotient;
+    }
+
+    // compute it the hard way with the Knuth algorithm
     divide(lhs, lhsWords, rhs, rhsWords, &quotient, nullptr);
     return quotient;
 }
@@ -2241,21 +2267,222 @@ SVInt SVInt::urem(const SVInt& lhs, const SVInt& rhs, bool bothSigned) {
     if (lhsWords == 1)
         return SVInt(lhs.bitWidth, lhs.pVal[0] % rhs.pVal[0], bothSigned);
 
-    // compute it the hard way with the Knuth algorithm
+    // very wide values with a wide quotient use recursive division
     SVInt remainder;
+    if (useRecursiveDivide(lhsBits, rhsBits)) {
+        SVInt quotient;
+        divideRecursive(lhs, rhs, quotient, remainder);
+        remainder.setSigned(bothSigned);
+        return remainder;
+    }
+
+    // compute it the hard way with the Knuth algorithm
     divide(lhs, lhsWords, rhs, rhsWords, nullptr, &remainder);
     return remainder;
 }
 
+void SVInt::udivrem(const SVInt& lhs, const SVInt& rhs, SVInt& quotient, SVInt& remainder) {
+    // Both values must be nonnegative, fully known, and have the same width,
+    // and rhs must be nonzero.
+    SLANG_ASSERT(lhs.bitWidth == rhs.bitWidth);
+    if (lhs.isSingleWord()) {
+        quotient = SVInt(lhs.bitWidth, lhs.val / rhs.val, false);
+        remainder = SVInt(lhs.bitWidth, lhs.val % rhs.val, false);
+        return;
+    }
+
+    if (lhs < rhs) {
+        quotient = SVInt(lhs.bitWidth, 0, false);
+        remainder = lhs;
+        return;
+    }
+
+    bitwidth_t lhsBits = lhs.getActiveBits();
+    uint32_t lhsWords = whichWord(lhsBits - 1) + 1;
+    bitwidth_t rhsBits = rhs.getActiveBits();
+    uint32_t rhsWords = whichWord(rhsBits - 1) + 1;
+
+    if (useRecursiveDivide(lhsBits, rhsBits))
+        divideRecursive(lhs, rhs, quotient, remainder);
+    else
+        divide(lhs, lhsWords, rhs, rhsWords, &quotient, &remainder);
+}
+
+// Returns the low bits of a value, keeping its width.
+static SVInt lowBits(const SVInt& value, bitwidth_t bits) {
+    return value.trunc(bits).zext(value.getBitWidth());
+}
+
+// Gets an unsigned copy of a value resized to the given number of bits.
+static SVInt unsignedResize(const SVInt& value, bitwidth_t bits) {
+    SVInt result = value;
+    result.setSigned(false);
+    return result.resize(bits);
+}
+
+void SVInt::divideRecursive(const SVInt& lhs, const SVInt& rhs, SVInt& quotient,
+                            SVInt& remainder) {
+    // This follows the Burnikel-Ziegler algorithm: the dividend is split into
+    // chunks the size of the divisor, and each chunk (along with the remainder
+    // from the previous one) is divided with the recursive 2n-by-n algorithm.
+    // All intermediate values fit in 2n bits plus a little headroom.
+    bitwidth_t n = rhs.getActiveBits();
+    uint32_t chunks = (lhs.getActiveBits() + n - 1) / n;
+    bitwidth_t width = 2 * n + 8;
+
+    SVInt a = unsignedResize(lhs, chunks * n);
+    SVInt b = unsignedResize(rhs, width);
+    SVInt q(chunks * n, 0, false);
+    SVInt r(width, 0, false);
+
+    for (uint32_t i = chunks; i > 0; i--) {
+        int32_t lsb = int32_t((i - 1) * n);
+        int32_t msb = lsb + int32_t(n) - 1;
+        SVInt digit = a.slice(msb, lsb).zext(width);
+
+        SVInt qd;
+        divide2n1n(r.shl(n) | digit, b, n, qd, r);
+        q.set(msb, lsb, qd.trunc(n));
+    }
+
+    quotient = q.resize(lhs.bitWidth);
+    remainder = r.resize(rhs.bitWidth);
+}
+
+void SVInt::divide2n1n(const SVInt& a, const SVInt& b, bitwidth_t n, SVInt& quotient,
+                       SVInt& remainder) {
+    // Divides a by b, where b has exactly n bits and a < (b << n).
+    // The results have the same width as b.
+    bitwidth_t resultWidth = b.bitWidth;
+    if (!useRecursiveDivide(a.getActiveBits(), n)) {
+        udivrem(a, b, quotient, remainder);
+        return;
+    }
+
+    bitwidth_t width = 2 * n + 8;
+    SVInt x = a.resize(width);
+    SVInt y = b.resize(width);
+
+    // The algorithm needs an even number of bits to split in half.
+    bool pad = n & 1;
+    if (pad) {
+        x = x.shl(1);
+        y = y.shl(1);
+        n++;
+    }
+
+    bitwidth_t half = n / 2;
+    SVInt b1 = y.lshr(half);
+    SVInt b2 = lowBits(y, half);
+
+    SVInt q1, q2, r;
+    divide3n2n(x.lshr(n), lowBits(x.lshr(half), half), y, b1, b2, half, q1, r);
+    divide3n2n(r, lowBits(x, half), y, b1, b2, half, q2, r);
+
+    if (pad)
+        r = r.lshr(1);
+
+    quotient = (q1.shl(half) | q2).resize(resultWidth);
+    remainder = r.resize(resultWidth);
+}
+
+void SVInt::divide3n2n(const SVInt& a12, const SVInt& a3, const SVInt& b, const SVInt& b1,
+                       const SVInt& b2, bitwidth_t n, SVInt& quotient, SVInt& remainder) {
+    // Divides (a12 << n | a3) by b = (b1 << n | b2), where b1 and b2 each have n bits.
+    // All values share the same width.
+    SVInt one(b.bitWidth, 1, false);
+    if (a12.lshr(n) == b1) {
+        quotient = one.shl(n) - one;
+        remainder = a12 - b1.shl(n) + b1;
+    }
+    else {
+        divide2n1n(a12, b1, n, quotient, remainder);
+    }
+
+    // The estimate from dividing by just the top half of b can be too
+    // large by at most two, which we correct for here.
+    SVInt t = remainder.shl(n) | a3;
+    SVInt p = quotient * b2;
+    while (t < p) {
+        quotient -= one;
+        t += b;
+    }
+    remainder = t - p;
+}
+
+void SVInt::writeDecimalDigits(SmallVectorBase<char>& buffer, const SVInt& value,
+                               std::span<const SVInt> powers, size_t minDigits) {
+    // The powers list holds 10^(9 * 2^k) for increasing k. Large values are split
+    // in two by the largest power that's at most about half their size, which keeps
+    // the total cost down to that of the (recursive) divisions.
+    size_t startOffset = buffer.size();
+    bitwidth_t activeBits = value.getActiveBits();
+
+    size_t k = powers.size();
+    if (activeBits > DecimalSplitThreshold) {
+        while (k > 0 && powers[k - 1].getActiveBits() * 2 > activeBits + 1)
+            k--;
+    }
+    else {
+        k = 0;
+    }
+
+    if (k > 0) {
+        auto& divisor = powers[k - 1];
+        SVInt hi, lo;
+        udivrem(unsignedResize(value, value.bitWidth), unsignedResize(divisor, value.bitWidth),
+                hi, lo);
+
+        size_t loDigits = size_t(9) << (k - 1);
+        writeDecimalDigits(buffer, lo.trunc(std::max(divisor.getActiveBits(), 1u)),
+                           powers.first(k - 1), loDigits);
+        if (hi != 0)
+            writeDecimalDigits(buffer, hi.trunc(std::max(hi.getActiveBits(), 1u)),
+                               powers.first(k - 1), 0);
+    }
+    else {
+        // Divide by 10^9 at a time, which gives us nine digits
+        // for each pass over the words of the value.
+        uint32_t numWords = getNumWords(value.bitWidth, false);
+        TempBuffer<uint64_t, 128> words(numWords);
+        memcpy(words.get(), value.getRawData(), numWords * WORD_SIZE);
+
+        while (numWords > 0 && words.get()[numWords - 1] == 0)
+            numWords--;
+
+        while (numWords > 0) {
+            uint32_t chunk = divideWordsBy(words.get(), numWords, 1000000000);
+            while (numWords > 0 && words.get()[numWords - 1] == 0)
+                numWords--;
+
+            if (numWords > 0) {
+                for (int i = 0; i < 9; i++) {
+                    buffer.push_back(char('0' + chunk % 10));
+                    chunk /= 10;
+                }
+            }
+            else {
+                while (chunk) {
+                    buffer.push_back(char('0' + chunk % 10));
+                    chunk /= 10;
+                }
+            }
+        }
+    }
+
+    while (buffer.size() - startOffset < minDigits)
+        buffer.push_back('0');
+}
+
 SVInt SVInt::modPow(const SVInt& base, const SVInt& exponent, bool bothSigned) {
     // This is based on the modular exponentiation algorithm described here:
     // https://en.wikipedia.org/wiki/Modular_exponentiation
     //
     // The result value will have the same bit width as the lhs. That's the value we'll
     // be using as the modulus in the (a * b) mod m equation.
-    // Allocate a temporary scratch buffer that has 2x the number of bits so that we can
+    // Allocate a temporary scratch buffer that has 2x the number of words so that we can
     // handle any possible intermediate multiply.
-    TempBuffer<uint64_t, 128> scratch(getNumWords(base.bitWidth * 2, false));
+    TempBuffer<uint64_t, 128> scratch(getNumWords(base.bitWidth, false) * 2);
     SVInt baseCopy = base;
     SVInt result(base.bitWidth, 1, false);
 
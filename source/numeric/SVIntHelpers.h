@@ -101,13 +101,67 @@ private:
     alignas(T) char stackBase[StackCount * sizeof(T)];
 };
 
-static void lshrNear(uint64_t* dst, uint64_t* src, uint32_t words, uint32_t amount) {
-    // fast case for logical right shift of a small amount (less than 64 bits)
-    uint64_t carry = 0;
-    for (int i = int(words - 1); i >= 0; i--) {
-        uint64_t temp = src[i];
-        dst[i] = (temp >> amount) | carry;
-        carry = temp << (64 - amount);
+static void lshrNear(uint64_t* dst, const uint64_t* src, uint32_t words, uint32_t amount) {
+    // fast case for logical right shift of a small amount (greater than zero and
+    // less than 64 bits). Each output word depends only on the inputs so that
+    // the loop has no carried dependency and can be vectorized.
+    for (uint32_t i = 0; i < words - 1; i++)
+        dst[i] = (src[i] >> amount) | (src[i + 1] << (64 - amount));
+    dst[words - 1] = src[words - 1] >> amount;
+}
+
+static void shlNear(uint64_t* dst, const uint64_t* src, uint32_t words, uint32_t amount) {
+    // fast case for left shift of a small amount (greater than zero and less than 64 bits)
+    dst[0] = src[0] << amount;
+    for (uint32_t i = 1; i < words; i++)
+        dst[i] = (src[i] << amount) | (src[i - 1] >> (64 - amount));
+}
+
+// Word-wise bitwise kernels for fully known values. These are kept trivially
+// simple so that the compiler can vectorize them for wide operands.
+static void andWords(uint64_t* dst, const uint64_t* x, const uint64_t* y, uint32_t words) {
+    for (uint32_t i = 0; i < words; i++)
+        dst[i] = x[i] & y[i];
+}
+
+static void orWords(uint64_t* dst, const uint64_t* x, const uint64_t* y, uint32_t words) {
+    for (uint32_t i = 0; i < words; i++)
+        dst[i] = x[i] | y[i];
+}
+
+static void xorWords(uint64_t* dst, const uint64_t* x, const uint64_t* y, uint32_t words) {
+    for (uint32_t i = 0; i < words; i++)
+        dst[i] = x[i] ^ y[i];
+}
+
+// Merges two values as in a conditional operator with an unknown condition:
+// result bits are unknown if either input bit is unknown or the bits differ.
+// The unknown words for either input can be null if that input is fully known.
+// The result's unknown words are written directly after its value words.
+static void mergeUnknownWords(uint64_t* dst, const uint64_t* x, const uint64_t* xu,
+                              const uint64_t* y, const uint64_t* yu, uint32_t words) {
+    uint64_t* du = dst + words;
+    if (xu && yu) {
+        for (uint32_t i = 0; i < words; i++) {
+            uint64_t unknown = xu[i] | yu[i] | (x[i] ^ y[i]);
+            du[i] = unknown;
+            dst[i] = ~unknown & x[i] & y[i];
+        }
+    }
+    else if (xu || yu) {
+        const uint64_t* u = xu ? xu : yu;
+        for (uint32_t i = 0; i < words; i++) {
+            uint64_t unknown = u[i] | (x[i] ^ y[i]);
+            du[i] = unknown;
+            dst[i] = ~unknown & x[i] & y[i];
+        }
+    }
+    else {
+        for (uint32_t i = 0; i < words; i++) {
+            uint64_t unknown = x[i] ^ y[i];
+            du[i] = unknown;
+            dst[i] = ~unknown & x[i] & y[i];
+        }
     }
 }
 
@@ -290,13 +344,27 @@ static uint64_t mulOne(uint64_t* dst, const uint64_t* x, uint32_t len, uint64_t
     return carry;
 }
 
+// Operands with at least this many words on both sides are multiplied with
+// Karatsuba's algorithm instead of the schoolbook method. The value comes from
+// the BM_SVIntMulWide benchmarks, which show where the two methods cross over.
+static constexpr uint32_t KaratsubaThreshold = 24;
+
+// Divisions where both the divisor and the quotient have at least this many words
+// use recursive (Burnikel-Ziegler) division instead of Knuth's algorithm, which
+// lets the bulk of the work happen in Karatsuba multiplies.
+static constexpr uint32_t RecursiveDivideThreshold = 32;
+
+// Values with more than this many bits are converted to decimal by recursively
+// splitting them by powers of ten instead of by repeated short division.
+static constexpr uint32_t DecimalSplitThreshold = 4096;
+
 static void mulKaratsuba(uint64_t* dst, const uint64_t* x, uint32_t xlen, const uint64_t* y,
                          uint32_t ylen);
 
 // Generalized multiplier
 SLANG_NO_SANITIZE("unsigned-integer-overflow")
 static void mul(uint64_t* dst, const uint64_t* x, uint32_t xlen, const uint64_t* y, uint32_t ylen) {
-    if (xlen > 7 && ylen > 7) {
+    if (xlen >= KaratsubaThreshold && ylen >= KaratsubaThreshold) {
         mulKaratsuba(dst, x, xlen, y, ylen);
         return;
     }
@@ -345,6 +413,19 @@ static void mulKaratsuba(uint64_t* dst, const uint64_t* x, uint32_t xlen, const
     }
 
     uint32_t shift = ylen >> 1;
+    if (xlen <= shift) {
+        // The operands are too unbalanced to split at the same point, so
+        // instead multiply x by each xlen-sized chunk of y and accumulate.
+        // Each partial sum is less than x * y, so there is never a carry out.
+        memset(dst, 0, (xlen + ylen) * sizeof(uint64_t));
+        TempBuffer<uint64_t, 128> t(2 * xlen);
+        for (uint32_t i = 0; i < ylen; i += xlen) {
+            uint32_t len = std::min(xlen, ylen - i);
+            mul(t.get(), x, xlen, y + i, len);
+            addGeneral(dst + i, dst + i, t.get(), xlen + len);
+        }
+        return;
+    }
 
     uint32_t xlSize = std::min(xlen, shift);
     uint32_t xhSize = xlen - xlSize;
@@ -385,6 +466,25 @@ static void mulKaratsuba(uint64_t* dst, const uint64_t* x, uint32_t xlen, const
     addGeneral(dst + shift, dst + shift, t3.get(), remaining);
 }
 
+// Divides an integer array in place by a single 32-bit divisor, returning the remainder.
+static uint32_t divideWordsBy(uint64_t* words, uint32_t len, uint32_t divisor) {
+    // Each word is handled as two 32-bit halves so that the running
+    // remainder and the next half always fit in a 64-bit dividend.
+    uint64_t rem = 0;
+    for (int i = int(len - 1); i >= 0; i--) {
+        uint64_t hi = (rem << 32) | (words[i] >> 32);
+        uint64_t qhi = hi / divisor;
+        rem = hi - qhi * divisor;
+
+        uint64_t lo = (rem << 32) | (words[i] & UINT32_MAX);
+        uint64_t qlo = lo / divisor;
+        rem = lo - qlo * divisor;
+
+        words[i] = (qhi << 32) | qlo;
+    }
+    return uint32_t(rem);
+}
+
 // Implementation of Knuth's Algorithm D (Division of nonnegative integers)
 // from "Art of Computer Programming, Volume 2", section 4.3.1, p. 272.
 // Note that this implementation is based on the APInt implementation from
@@ -7,6 +7,7 @@
 //------------------------------------------------------------------------------
 #include "slang/parsing/Lexer.h"
 
+#include "LexerScan.h"
 #include <cmath>
 #include <fmt/core.h>
 
@@ -685,6 +686,13 @@ Token Lexer::lexStringLiteral() {
     stringBuffer.clear();
     bool sawUTF8Error = false;
     while (true) {
+        // Copy over any run of characters that don't need special handling.
+        if (auto runEnd = scan::skipStringText(sourceBuffer, sourceEnd); runEnd != sourceBuffer) {
+            stringBuffer.append(sourceBuffer, runEnd);
+            sourceBuffer = runEnd;
+            sawUTF8Error = false;
+        }
+
         size_t offset = currentOffset();
         char c = peek();
 
@@ -1166,36 +1174,23 @@ void Lexer::lexTrivia() {
 }
 
 void Lexer::scanIdentifier() {
-    while (true) {
-        char c = peek();
-        if (isAlphaNumeric(c) || c == '_' || c == '$')
-            advance();
-        else
-            return;
-    }
+    sourceBuffer = scan::skipIdentifier(sourceBuffer, sourceEnd);
 }
 
 void Lexer::scanWhitespace() {
-    bool done = false;
-    while (!done) {
-        switch (peek()) {
-            case ' ':
-            case '\t':
-            case '\v':
-            case '\f':
-                advance();
-                break;
-            default:
-                done = true;
-                break;
-        }
-    }
+    sourceBuffer = scan::skipWhitespace(sourceBuffer, sourceEnd);
     addTrivia(TriviaKind::Whitespace);
 }
 
 void Lexer::scanLineComment() {
     bool sawUTF8Error = false;
     while (true) {
+        if (auto runEnd = scan::skipLineCommentText(sourceBuffer, sourceEnd);
+            runEnd != sourceBuffer) {
+            sourceBuffer = runEnd;
+            sawUTF8Error = false;
+        }
+
         char c = peek();
         if (isASCII(c)) {
             if (isNewline(c))
@@ -1222,6 +1217,12 @@ void Lexer::scanLineComment() {
 void Lexer::scanBlockComment() {
     bool sawUTF8Error = false;
     while (true) {
+        if (auto runEnd = scan::skipBlockCommentText(sourceBuffer, sourceEnd);
+            runEnd != sourceBuffer) {
+            sourceBuffer = runEnd;
+            sawUTF8Error = false;
+        }
+
         char c = peek();
         if (isASCII(c)) {
             sawUTF8Error = false;
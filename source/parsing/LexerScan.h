@@ -0,0 +1,182 @@
+//------------------------------------------------------------------------------
+// LexerScan.h
+// Contains internal helper functions for scanning runs of characters in the lexer
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+#if defined(__AVX2__)
+#    include <immintrin.h>
+#    define SLANG_LEXER_SIMD_WIDTH 32
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#    include <emmintrin.h>
+#    define SLANG_LEXER_SIMD_WIDTH 16
+#endif
+
+// Each of the scan functions in this file returns a pointer to the first character
+// at or after the given position that isn't part of the run being scanned. Source
+// buffers are always null terminated and none of the runs include a null character,
+// so the scalar loops are guaranteed to stop before running off the end. Vector
+// loads are only done when a whole block fits before @a end; the remaining tail
+// is handled one character at a time. Characters outside of the ASCII range always
+// end a run so that the lexer can decode and validate them itself.
+
+namespace slang::parsing::scan {
+
+#ifdef SLANG_LEXER_SIMD_WIDTH
+
+struct Vec {
+#    if SLANG_LEXER_SIMD_WIDTH == 32
+    using Type = __m256i;
+
+    static Type load(const char* p) { return _mm256_loadu_si256((const __m256i*)p); }
+    static Type splat(char c) { return _mm256_set1_epi8(c); }
+    static Type eq(Type a, char c) { return _mm256_cmpeq_epi8(a, splat(c)); }
+    static Type gt(Type a, Type b) { return _mm256_cmpgt_epi8(a, b); }
+    static Type bitOr(Type a, Type b) { return _mm256_or_si256(a, b); }
+    static Type bitAnd(Type a, Type b) { return _mm256_and_si256(a, b); }
+    static uint32_t mask(Type a) { return (uint32_t)_mm256_movemask_epi8(a); }
+
+    static constexpr uint32_t AllBits = 0xffffffff;
+#    else
+    using Type = __m128i;
+
+    static Type load(const char* p) { return _mm_loadu_si128((const __m128i*)p); }
+    static Type splat(char c) { return _mm_set1_epi8(c); }
+    static Type eq(Type a, char c) { return _mm_cmpeq_epi8(a, splat(c)); }
+    static Type gt(Type a, Type b) { return _mm_cmpgt_epi8(a, b); }
+    static Type bitOr(Type a, Type b) { return _mm_or_si128(a, b); }
+    static Type bitAnd(Type a, Type b) { return _mm_and_si128(a, b); }
+    static uint32_t mask(Type a) { return (uint32_t)_mm_movemask_epi8(a); }
+
+    static constexpr uint32_t AllBits = 0xffff;
+#    endif
+
+    static constexpr int Width = SLANG_LEXER_SIMD_WIDTH;
+
+    // Mask of bytes within the inclusive (signed) range [lo, hi].
+    static Type inRange(Type a, char lo, char hi) {
+        return bitAnd(gt(a, splat(char(lo - 1))), gt(splat(char(hi + 1)), a));
+    }
+};
+
+// Advances over whole blocks of characters until @a stopMask reports a bit set
+// for some character in the block, and returns a pointer to that character.
+template<typename TFunc>
+inline const char* scanBlocks(const char* p, const char* end, TFunc&& stopMask) {
+    while (end - p >= Vec::Width) {
+        if (uint32_t m = stopMask(Vec::load(p)))
+            return p + std::countr_zero(m);
+        p += Vec::Width;
+    }
+    return p;
+}
+
+#endif
+
+/// Skips over spaces, tabs, vertical tabs, and form feeds.
+inline const char* skipWhitespace(const char* p, const char* end) {
+#ifdef SLANG_LEXER_SIMD_WIDTH
+    p = scanBlocks(p, end, [](Vec::Type v) {
+        auto ws = Vec::bitOr(Vec::bitOr(Vec::eq(v, ' '), Vec::eq(v, '\t')),
+                             Vec::bitOr(Vec::eq(v, '\v'), Vec::eq(v, '\f')));
+        return ~Vec::mask(ws) & Vec::AllBits;
+    });
+#else
+    (void)end;
+#endif
+    while (*p == ' ' || *p == '\t' || *p == '\v' || *p == '\f')
+        p++;
+    return p;
+}
+
+/// Skips over characters that can continue a simple identifier:
+/// letters, digits, underscores, and dollar signs.
+inline const char* skipIdentifier(const char* p, const char* end) {
+#ifdef SLANG_LEXER_SIMD_WIDTH
+    p = scanBlocks(p, end, [](Vec::Type v) {
+        auto alpha = Vec::inRange(Vec::bitOr(v, Vec::splat(0x20)), 'a', 'z');
+        auto digit = Vec::inRange(v, '0', '9');
+        auto ident = Vec::bitOr(Vec::bitOr(alpha, digit),
+                                Vec::bitOr(Vec::eq(v, '_'), Vec::eq(v, '$')));
+        return ~Vec::mask(ident) & Vec::AllBits;
+    });
+#else
+    (void)end;
+#endif
+    while (true) {
+        char c = *p;
+        if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+            c == '_' || c == '$') {
+            p++;
+        }
+        else {
+            return p;
+        }
+    }
+}
+
+/// Skips over the plain ASCII text of a line comment, stopping at a newline.
+inline const char* skipLineCommentText(const char* p, const char* end) {
+#ifdef SLANG_LEXER_SIMD_WIDTH
+    p = scanBlocks(p, end, [](Vec::Type v) {
+        auto stop = Vec::bitOr(Vec::bitOr(Vec::eq(v, '\n'), Vec::eq(v, '\r')), Vec::eq(v, 0));
+        return Vec::mask(stop) | Vec::mask(v);
+    });
+#else
+    (void)end;
+#endif
+    while (true) {
+        char c = *p;
+        if (c == '\n' || c == '\r' || c == '\0' || (c & 0x80))
+            return p;
+        p++;
+    }
+}
+
+/// Skips over the plain ASCII text of a block comment, stopping at any character
+/// that could begin the end of the comment or a nested comment start.
+inline const char* skipBlockCommentText(const char* p, const char* end) {
+#ifdef SLANG_LEXER_SIMD_WIDTH
+    p = scanBlocks(p, end, [](Vec::Type v) {
+        auto stop = Vec::bitOr(Vec::bitOr(Vec::eq(v, '*'), Vec::eq(v, '/')), Vec::eq(v, 0));
+        return Vec::mask(stop) | Vec::mask(v);
+    });
+#else
+    (void)end;
+#endif
+    while (true) {
+        char c = *p;
+        if (c == '*' || c == '/' || c == '\0' || (c & 0x80))
+            return p;
+        p++;
+    }
+}
+
+/// Skips over the plain ASCII contents of a string literal, stopping at quotes,
+/// escape sequences, and newlines.
+inline const char* skipStringText(const char* p, const char* end) {
+#ifdef SLANG_LEXER_SIMD_WIDTH
+    p = scanBlocks(p, end, [](Vec::Type v) {
+        auto quote = Vec::bitOr(Vec::eq(v, '"'), Vec::eq(v, '\\'));
+        auto newline = Vec::bitOr(Vec::eq(v, '\n'), Vec::eq(v, '\r'));
+        auto stop = Vec::bitOr(Vec::bitOr(quote, newline), Vec::eq(v, 0));
+        return Vec::mask(stop) | Vec::mask(v);
+    });
+#else
+    (void)end;
+#endif
+    while (true) {
+        char c = *p;
+        if (c == '"' || c == '\\' || c == '\n' || c == '\r' || c == '\0' || (c & 0x80))
+            return p;
+        p++;
+    }
+}
+
+} // namespace slang::parsing::scan
@@ -41,6 +41,9 @@ Preprocessor::Preprocessor(SourceManager& sourceManager, BumpAllocator& alloc,
             macros.emplace(name, define);
     }
 
+    if (options.snapshot)
+        restoreSnapshot(*options.snapshot);
+
     // clang-format off
     pragmaProtectHandlers = {
         { "begin", &Preprocessor::handleProtectBegin },
@@ -99,12 +102,57 @@ void Preprocessor::pushSource(SourceBuffer buffer) {
     SLANG_ASSERT(buffer.id);
 
     lexerStack.emplace_back(std::make_unique<Lexer>(buffer, alloc, diagnostics, lexerOptions));
+    guardStack.emplace_back(buffer);
 }
 
 void Preprocessor::popSource() {
+    // If the whole file turned out to be wrapped in an include guard, remember
+    // the guard macro so that later includes can skip the file while it's defined.
+    auto& guard = guardStack.back();
+    if (guard.state == IncludeGuardState::Done)
+        includeGuards[guard.buffer.data.data()] = {guard.name, guard.buffer.id};
+
     if (includeDepth)
         includeDepth--;
     lexerStack.pop_back();
+    guardStack.pop_back();
+}
+
+void Preprocessor::trackIncludeGuard(Token token) {
+    // Any token other than the opening `ifndef that appears outside of the
+    // guard block means the file isn't guarded. Tokens inside the block are
+    // tracked via the conditional directive handlers instead.
+    auto& guard = guardStack.back();
+    switch (guard.state) {
+        case IncludeGuardState::Start:
+            if (token.kind == TokenKind::Directive &&
+                token.directiveKind() == SyntaxKind::IfNDefDirective) {
+                guard.state = IncludeGuardState::ExpectIfNDef;
+            }
+            else {
+                guard.state = IncludeGuardState::Invalid;
+            }
+            break;
+        case IncludeGuardState::Done:
+            if (token.kind != TokenKind::EndOfFile)
+                guard.state = IncludeGuardState::Invalid;
+            break;
+        default:
+            break;
+    }
+}
+
+bool Preprocessor::isIncludeGuarded(const SourceBuffer& buffer) const {
+    if (auto it = includeGuards.find(buffer.data.data()); it != includeGuards.end())
+        return macros.contains(it->second.first);
+
+    if (!includeGuardPaths.empty()) {
+        auto it = includeGuardPaths.find(sourceManager.getFullPath(buffer.id).string());
+        if (it != includeGuardPaths.end())
+            return macros.contains(it->second);
+    }
+
+    return false;
 }
 
 void Preprocessor::predefine(const std::string& definition, std::string_view name) {
@@ -210,6 +258,62 @@ std::vector<const DefineDirectiveSyntax*> Preprocessor::getDefinedMacros() const
     return results;
 }
 
+void Preprocessor::saveSnapshot(PreprocessorSnapshot& snapshot) const {
+    snapshot.macros.clear();
+    for (auto& [name, def] : macros) {
+        if (def.syntax && !def.builtIn && !def.commandLine)
+            snapshot.macros.push_back(def.syntax);
+    }
+
+    std::ranges::sort(snapshot.macros,
+                      [](const DefineDirectiveSyntax* a, const DefineDirectiveSyntax* b) {
+                          return a->name.valueText() < b->name.valueText();
+                      });
+
+    snapshot.includeOnceHeaders.clear();
+    for (auto& [text, buffer] : includeOnceHeaders) {
+        auto& path = sourceManager.getFullPath(buffer);
+        if (!path.empty())
+            snapshot.includeOnceHeaders.push_back(path.string());
+    }
+    for (auto& path : includeOncePaths)
+        snapshot.includeOnceHeaders.push_back(path);
+
+    std::ranges::sort(snapshot.includeOnceHeaders);
+    auto [first, last] = std::ranges::unique(snapshot.includeOnceHeaders);
+    snapshot.includeOnceHeaders.erase(first, last);
+
+    snapshot.includeGuards.clear();
+    flat_hash_map<std::string, std::string> guards = includeGuardPaths;
+    for (auto& [text, guard] : includeGuards) {
+        auto& [name, buffer] = guard;
+        auto& path = sourceManager.getFullPath(buffer);
+        if (!path.empty())
+            guards[path.string()] = std::string(name);
+    }
+
+    snapshot.includeGuards.assign(guards.begin(), guards.end());
+    std::ranges::sort(snapshot.includeGuards);
+}
+
+void Preprocessor::restoreSnapshot(const PreprocessorSnapshot& snapshot) {
+    for (auto define : snapshot.macros) {
+        auto name = define->name.valueText();
+        if (name.empty())
+            continue;
+
+        auto& def = macros[name];
+        if (!def.builtIn)
+            def = MacroDef(define);
+    }
+
+    for (auto& path : snapshot.includeOnceHeaders)
+        includeOncePaths.emplace(path);
+
+    for (auto& [path, name] : snapshot.includeGuards)
+        includeGuardPaths[path] = name;
+}
+
 Token Preprocessor::next() {
     return consume();
 }
@@ -408,6 +512,7 @@ Token Preprocessor::nextRaw() {
     // This is the common case.
     auto& source = lexerStack.back();
     auto token = source->lex(keywordVersionStack.back());
+    trackIncludeGuard(token);
     if (token.kind != TokenKind::EndOfFile)
         return token;
 
@@ -438,6 +543,7 @@ Token Preprocessor::nextRaw() {
     while (true) {
         auto& nextSource = lexerStack.back();
         token = nextSource->lex(keywordVersionStack.back());
+        trackIncludeGuard(token);
         appendTrivia(token);
         if (token.kind != TokenKind::EndOfFile)
             break;
@@ -534,7 +640,14 @@ Trivia Preprocessor::handleIncludeDirective(Token directive) {
         else if (includeDepth >= options.maxIncludeDepth) {
             addDiag(diag::ExceededMaxIncludeDepth, fileName.range());
         }
-        else if (includeOnceHeaders.find(buffer->data.data()) == includeOnceHeaders.end()) {
+        else if (isIncludeGuarded(*buffer)) {
+            // The header's guard macro is already defined, so including it
+            // again would have no effect; avoid lexing it at all.
+            numSkippedIncludes++;
+        }
+        else if (includeOnceHeaders.find(buffer->data.data()) == includeOnceHeaders.end() &&
+                 (includeOncePaths.empty() ||
+                  !includeOncePaths.contains(sourceManager.getFullPath(buffer->id).string()))) {
             includeDepth++;
             pushSource(*buffer);
         }
@@ -688,18 +801,34 @@ Trivia Preprocessor::handleIfDefDirective(Token directive, bool inverted) {
             take = !take;
     }
 
+    // If this is the first token in the file it might be the start of an include guard.
+    if (!guardStack.empty() && guardStack.back().state == IncludeGuardState::ExpectIfNDef) {
+        auto& guard = guardStack.back();
+        if (inverted && expr.kind == SyntaxKind::NamedConditionalDirectiveExpression) {
+            guard.name = expr.as<NamedConditionalDirectiveExpressionSyntax>().name.valueText();
+            guard.branchDepth = branchStack.size();
+            guard.state = guard.name.empty() ? IncludeGuardState::Invalid
+                                             : IncludeGuardState::Inside;
+        }
+        else {
+            guard.state = IncludeGuardState::Invalid;
+        }
+    }
+
     branchStack.emplace_back(BranchEntry(directive, take));
 
     return parseBranchDirective(directive, &expr, take);
 }
 
 Trivia Preprocessor::handleElsIfDirective(Token directive) {
+    checkIncludeGuardElse();
     auto& expr = parseConditionalExprTop();
     bool take = shouldTakeElseBranch(directive.location(), &expr);
     return parseBranchDirective(directive, &expr, take);
 }
 
 Trivia Preprocessor::handleElseDirective(Token directive) {
+    checkIncludeGuardElse();
     bool take = shouldTakeElseBranch(directive.location(), nullptr);
     return parseBranchDirective(directive, nullptr, take);
 }
@@ -793,10 +922,29 @@ Trivia Preprocessor::handleEndIfDirective(Token directive) {
         branchStack.pop_back();
         if (!branchStack.empty() && !branchStack.back().currentActive)
             taken = false;
+
+        if (!guardStack.empty()) {
+            auto& guard = guardStack.back();
+            if (guard.state == IncludeGuardState::Inside &&
+                branchStack.size() == guard.branchDepth) {
+                guard.state = IncludeGuardState::Done;
+            }
+        }
     }
     return parseBranchDirective(directive, nullptr, taken);
 }
 
+void Preprocessor::checkIncludeGuardElse() {
+    // An `else or `elsif attached to the guard block means
+    // the file has content even when the guard is defined.
+    if (guardStack.empty())
+        return;
+
+    auto& guard = guardStack.back();
+    if (guard.state == IncludeGuardState::Inside && branchStack.size() == guard.branchDepth + 1)
+        guard.state = IncludeGuardState::Invalid;
+}
+
 bool Preprocessor::expectTimeScaleSpecifier(Token& token, TimeScaleValue& value) {
     if (peek(TokenKind::IntegerLiteral)) {
         // We wanted to see a time literal here, but for directives we will allow there
@@ -0,0 +1,112 @@
+//------------------------------------------------------------------------------
+// PreprocessorSnapshot.cpp
+// Saved preprocessor state for reuse across compilation units
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "slang/parsing/Preprocessor.h"
+#include "slang/syntax/AllSyntax.h"
+#include "slang/syntax/SyntaxPrinter.h"
+#include "slang/text/SourceManager.h"
+
+namespace slang::parsing {
+
+using namespace syntax;
+
+// Prefix for the comment lines that record `pragma once headers in serialized snapshots.
+static constexpr std::string_view OnceHeaderPrefix = "//! once "sv;
+
+// Prefix for the comment lines that record guarded headers, as "<macro> <path>".
+static constexpr std::string_view GuardHeaderPrefix = "//! guard "sv;
+
+std::shared_ptr<PreprocessorSnapshot> PreprocessorSnapshot::fromBuffers(
+    SourceManager& sourceManager, std::span<const SourceBuffer> buffers,
+    Diagnostics& diagnostics, const Bag& options) {
+
+    // Don't build on top of an existing snapshot, since our macros
+    // would then point into memory that we don't own.
+    Bag ppBag = options;
+    auto ppOptions = options.getOrDefault<PreprocessorOptions>();
+    ppOptions.snapshot = nullptr;
+    ppBag.set(ppOptions);
+
+    auto result = std::make_shared<PreprocessorSnapshot>();
+    Preprocessor preprocessor(sourceManager, result->alloc, diagnostics, ppBag);
+    for (auto it = buffers.rbegin(); it != buffers.rend(); it++)
+        preprocessor.pushSource(*it);
+
+    while (preprocessor.next().kind != TokenKind::EndOfFile) {
+        // Nothing to do but keep going.
+    }
+
+    preprocessor.saveSnapshot(*result);
+    return result;
+}
+
+std::shared_ptr<PreprocessorSnapshot> PreprocessorSnapshot::deserialize(
+    SourceManager& sourceManager, const SourceBuffer& buffer, Diagnostics& diagnostics,
+    const Bag& options) {
+
+    auto result = fromBuffers(sourceManager, std::span(&buffer, 1), diagnostics, options);
+
+    // The macros are restored by preprocessing the text; the include-once
+    // and guarded headers are listed in specially formatted comments.
+    auto text = buffer.data;
+    while (!text.empty()) {
+        auto line = text.substr(0, text.find('\n'));
+        text.remove_prefix(std::min(line.size() + 1, text.size()));
+
+        while (!line.empty() && (line.back() == '\r' || line.back() == '\0'))
+            line.remove_suffix(1);
+
+        if (line.starts_with(OnceHeaderPrefix))
+            result->includeOnceHeaders.emplace_back(line.substr(OnceHeaderPrefix.size()));
+        else if (line.starts_with(GuardHeaderPrefix)) {
+            line.remove_prefix(GuardHeaderPrefix.size());
+            auto space = line.find(' ');
+            if (space != std::string_view::npos && space > 0 && space + 1 < line.size()) {
+                result->includeGuards.emplace_back(std::string(line.substr(space + 1)),
+                                                   std::string(line.substr(0, space)));
+            }
+        }
+    }
+
+    return result;
+}
+
+std::string PreprocessorSnapshot::serialize() const {
+    std::string result = "// Preprocessor snapshot generated by slang\n";
+    for (auto& path : includeOnceHeaders) {
+        result += OnceHeaderPrefix;
+        result += path;
+        result += '\n';
+    }
+    for (auto& [path, name] : includeGuards) {
+        result += GuardHeaderPrefix;
+        result += name;
+        result += ' ';
+        result += path;
+        result += '\n';
+    }
+
+    for (auto macro : macros) {
+        // Skip whatever trivia preceded the directive in its original source.
+        SyntaxPrinter printer;
+        printer.append(macro->directive.rawText());
+        printer.print(macro->name);
+        if (macro->formalArguments)
+            printer.print(*macro->formalArguments);
+        for (auto token : macro->body)
+            printer.print(token);
+
+        result += '\n';
+        result += printer.str();
+        if (result.back() != '\n')
+            result += '\n';
+    }
+
+    return result;
+}
+
+} // namespace slang::parsing
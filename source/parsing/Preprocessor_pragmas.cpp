@@ -236,9 +236,10 @@ void Preprocessor::applyResetAllPragma(const PragmaDirectiveSyntax& pragma) {
 void Preprocessor::applyOncePragma(const PragmaDirectiveSyntax& pragma) {
     ensurePragmaArgs(pragma, 0);
 
-    auto text = sourceManager.getSourceText(pragma.directive.location().buffer());
+    auto buffer = pragma.directive.location().buffer();
+    auto text = sourceManager.getSourceText(buffer);
     if (!text.empty())
-        includeOnceHeaders.emplace(text.data());
+        includeOnceHeaders.emplace(text.data(), buffer);
 }
 
 void Preprocessor::applyDiagnosticPragma(const PragmaDirectiveSyntax& pragma) {
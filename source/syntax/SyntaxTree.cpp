@@ -136,7 +136,7 @@ std::shared_ptr<SyntaxTree> SyntaxTree::create(SourceManager& sourceManager,
             return "<multi-buffer>"s;
     });
 
-    BumpAllocator alloc;
+    BumpAllocator alloc(options.getOrDefault<BumpAllocatorOptions>());
     Diagnostics diagnostics;
     Preprocessor preprocessor(sourceManager, alloc, diagnostics, options, inheritedMacros);
 
@@ -196,7 +196,7 @@ std::shared_ptr<SyntaxTree> SyntaxTree::fromLibraryMapText(std::string_view text
 std::shared_ptr<SyntaxTree> SyntaxTree::fromLibraryMapBuffer(const SourceBuffer& buffer,
                                                              SourceManager& sourceManager,
                                                              const Bag& options) {
-    BumpAllocator alloc;
+    BumpAllocator alloc(options.getOrDefault<BumpAllocatorOptions>());
     Diagnostics diagnostics;
     Preprocessor preprocessor(sourceManager, alloc, diagnostics, options);
     preprocessor.pushSource(buffer);
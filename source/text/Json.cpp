@@ -20,6 +20,25 @@ JsonWriter::JsonWriter() : buffer(std::make_unique<FormatBuffer>()) {
 
 JsonWriter::~JsonWriter() = default;
 
+void JsonWriter::setOutput(std::function<void(std::string_view)> newOutput, size_t bufferSize) {
+    output = std::move(newOutput);
+    outputBufferSize = bufferSize;
+}
+
+void JsonWriter::flush() {
+    if (!output)
+        return;
+
+    // Trailing separators stay in the buffer, since whether they're kept
+    // depends on what is written next.
+    auto size = findLastComma();
+    output(std::string_view(buffer->data(), size));
+
+    std::string tail(buffer->data() + size, buffer->size() - size);
+    buffer->clear();
+    buffer->append(tail);
+}
+
 std::string_view JsonWriter::view() const {
     return std::string_view(buffer->data(), findLastComma());
 }
@@ -162,6 +181,9 @@ void JsonWriter::endValue() {
     buffer->append(",");
     if (pretty)
         buffer->format("\n{:{}}", "", currentIndent);
+
+    if (output && buffer->size() >= outputBufferSize)
+        flush();
 }
 
 size_t JsonWriter::findLastComma() const {
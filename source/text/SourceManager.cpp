@@ -19,6 +19,16 @@ namespace slang {
 
 static const fs::path emptyPath;
 
+SourceManager::FileData::FileData(const fs::path* directory, std::string name,
+                                  SmallVector<char>&& data, std::unique_ptr<MappedFile>&& mapping,
+                                  fs::path fullPath) :
+    name(std::move(name)), mem(std::move(data)), mapping(std::move(mapping)),
+    text(this->mapping ? this->mapping->data() : std::string_view(mem.data(), mem.size())),
+    directory(directory), fullPath(std::move(fullPath)) {
+}
+
+SourceManager::FileData::~FileData() = default;
+
 SourceManager::SourceManager() {
     // add a dummy entry to the start of the directory list so that our file IDs line up
     FileInfo file;
@@ -72,8 +82,8 @@ size_t SourceManager::getColumnNumber(SourceLocation location) const {
     // walk backward to find start of line
     auto fd = info->data;
     size_t lineStart = location.offset();
-    SLANG_ASSERT(lineStart < fd->mem.size());
-    while (lineStart > 0 && fd->mem[lineStart - 1] != '\n' && fd->mem[lineStart - 1] != '\r')
+    SLANG_ASSERT(lineStart < fd->text.size());
+    while (lineStart > 0 && fd->text[lineStart - 1] != '\n' && fd->text[lineStart - 1] != '\r')
         lineStart--;
 
     return location.offset() - lineStart + 1;
@@ -210,8 +220,7 @@ std::string_view SourceManager::getSourceText(BufferID buffer) const {
     if (!info || !info->data)
         return "";
 
-    auto fd = info->data;
-    return std::string_view(fd->mem.data(), fd->mem.size());
+    return info->data->text;
 }
 
 uint64_t SourceManager::getSortKey(BufferID buffer) const {
@@ -433,7 +442,7 @@ SourceBuffer SourceManager::createBufferEntry(FileData* fd, SourceLocation inclu
         sortKey = bufferEntries.size() << 32;
 
     bufferEntries.emplace_back(FileInfo(fd, library, includedFrom, sortKey));
-    return SourceBuffer{std::string_view(fd->mem.data(), fd->mem.size()), library,
+    return SourceBuffer{fd->text, library,
                         BufferID((uint32_t)(bufferEntries.size() - 1), fd->name)};
 }
 
@@ -484,6 +493,16 @@ SourceManager::BufferOrError SourceManager::openCached(const fs::path& fullPath,
         }
     }
 
+    // try to map the file first, if enabled; this falls back to a normal
+    // read for files that can't be mapped with a trailing null terminator
+    if (memoryMapFiles) {
+        auto mapping = std::make_unique<MappedFile>();
+        if (!OS::mapFile(absPath, *mapping)) {
+            return cacheBuffer(std::move(absPath), std::move(pathStr), includedFrom, library,
+                               sortKey, {}, std::move(mapping));
+        }
+    }
+
     // do the read
     SmallVector<char> buffer;
     if (std::error_code ec = OS::readFile(absPath, buffer)) {
@@ -498,7 +517,8 @@ SourceManager::BufferOrError SourceManager::openCached(const fs::path& fullPath,
 
 SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
                                         SourceLocation includedFrom, const SourceLibrary* library,
-                                        uint64_t sortKey, SmallVector<char>&& buffer) {
+                                        uint64_t sortKey, SmallVector<char>&& buffer,
+                                        std::unique_ptr<MappedFile>&& mapping) {
     std::string name;
     if (!disableProximatePaths) {
         std::error_code ec;
@@ -514,7 +534,7 @@ SourceBuffer SourceManager::cacheBuffer(fs::path&& path, std::string&& pathStr,
 
     auto directory = &*directories.insert(path.parent_path()).first;
     auto fd = std::make_unique<FileData>(directory, std::move(name), std::move(buffer),
-                                         std::move(path));
+                                         std::move(mapping), std::move(path));
 
     // Note: it's possible that insertion here fails due to another thread
     // racing against us to open and insert the same file. We do a lookup
@@ -550,13 +570,13 @@ size_t SourceManager::getRawLineNumber(SourceLocation location, TLock& readLock)
             readLock.unlock();
 
             std::unique_lock writeLock(mutex);
-            computeLineOffsets(fd->mem, fd->lineOffsets);
+            computeLineOffsets(fd->text, fd->lineOffsets);
 
             writeLock.unlock();
             readLock.lock();
         }
         else {
-            computeLineOffsets(fd->mem, fd->lineOffsets);
+            computeLineOffsets(fd->text, fd->lineOffsets);
         }
     }
 
@@ -630,7 +650,7 @@ SourceLocation SourceManager::getOriginalLocImpl(SourceLocation location, TLock&
     return std::get<ExpansionInfo>(bufferEntries[buffer.getId()]).originalLoc + location.offset();
 }
 
-void SourceManager::computeLineOffsets(const SmallVector<char>& buffer,
+void SourceManager::computeLineOffsets(std::string_view buffer,
                                        std::vector<size_t>& offsets) noexcept {
     // first line always starts at offset 0
     offsets.push_back(0);
@@ -7,11 +7,19 @@
 //------------------------------------------------------------------------------
 #include "slang/util/BumpAllocator.h"
 
+#include <algorithm>
 #include <new>
 
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
 namespace slang {
 
-BumpAllocator::BumpAllocator() {
+BumpAllocator::BumpAllocator() : BumpAllocator(BumpAllocatorOptions{}) {
+}
+
+BumpAllocator::BumpAllocator(const BumpAllocatorOptions& options) : options(options) {
     head = allocSegment(nullptr, INITIAL_SIZE);
     endPtr = (byte*)head + INITIAL_SIZE;
 }
@@ -20,13 +28,14 @@ BumpAllocator::~BumpAllocator() {
     Segment* seg = head;
     while (seg) {
         Segment* prev = seg->prev;
-        ::operator delete(seg);
+        freeSegment(seg);
         seg = prev;
     }
 }
 
 BumpAllocator::BumpAllocator(BumpAllocator&& other) noexcept :
-    head(std::exchange(other.head, nullptr)), endPtr(other.endPtr) {
+    head(std::exchange(other.head, nullptr)), endPtr(std::exchange(other.endPtr, nullptr)),
+    numSegments(std::exchange(other.numSegments, 0)), options(other.options) {
 }
 
 BumpAllocator& BumpAllocator::operator=(BumpAllocator&& other) noexcept {
@@ -47,27 +56,95 @@ void BumpAllocator::steal(BumpAllocator&& other) {
 
     seg->prev = head->prev;
     head->prev = std::exchange(other.head, nullptr);
+    other.endPtr = nullptr;
+    other.numSegments = 0;
+}
+
+BumpAllocatorStats BumpAllocator::getStats() const {
+    BumpAllocatorStats stats;
+    for (Segment* seg = head; seg; seg = seg->prev) {
+        stats.bytesUsed += size_t(seg->current - (byte*)(seg + 1));
+        stats.bytesReserved += seg->size;
+        stats.segmentCount++;
+    }
+    return stats;
 }
 
 byte* BumpAllocator::allocateSlow(size_t size, size_t alignment) {
     // for really large allocations, give them their own segment
-    if (size > (SEGMENT_SIZE >> 1)) {
+    size_t segmentSize = nextSegmentSize();
+    if (size > (segmentSize >> 1)) {
         size = (size + alignment - 1) & ~(alignment - 1);
         head->prev = allocSegment(head->prev, size + sizeof(Segment));
-        return alignPtr(head->prev->current, alignment);
+
+        byte* base = alignPtr(head->prev->current, alignment);
+        head->prev->current = base + size;
+        return base;
     }
 
     // otherwise, start a new block
-    head = allocSegment(head, SEGMENT_SIZE);
-    endPtr = (byte*)head + SEGMENT_SIZE;
-    return allocate(size, alignment);
+    head = allocSegment(head, segmentSize);
+    endPtr = (byte*)head + head->size;
+    numSegments++;
+
+    byte* base = alignPtr(head->current, alignment);
+    head->current = base + size;
+    SLANG_ASSERT(head->current <= endPtr);
+    return base;
 }
 
-BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) {
-    auto seg = (Segment*)::operator new(size);
+size_t BumpAllocator::nextSegmentSize() const {
+    // Grow geometrically so that allocators holding a lot of memory
+    // don't end up with a huge number of small segments.
+    if (options.segmentsPerDoubling == 0 || options.segmentSize >= options.maxSegmentSize)
+        return options.segmentSize;
+
+    size_t size = options.segmentSize;
+    for (uint32_t i = numSegments / options.segmentsPerDoubling; i > 0; i--) {
+        size *= 2;
+        if (size >= options.maxSegmentSize)
+            return options.maxSegmentSize;
+    }
+    return size;
+}
+
+BumpAllocator::Segment* BumpAllocator::allocSegment(Segment* prev, size_t size) const {
+    Segment* seg = nullptr;
+    bool isHugePage = false;
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (options.useHugePages && size >= HUGE_PAGE_SIZE) {
+        // Round up to a whole number of huge pages; the rest of the
+        // memory would otherwise be backed by regular pages anyway.
+        size = (size + HUGE_PAGE_SIZE - 1) & ~size_t(HUGE_PAGE_SIZE - 1);
+        void* mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1,
+                         0);
+        if (mem != MAP_FAILED) {
+            madvise(mem, size, MADV_HUGEPAGE);
+            seg = (Segment*)mem;
+            isHugePage = true;
+        }
+    }
+#endif
+
+    if (!seg)
+        seg = (Segment*)::operator new(size);
+
     seg->prev = prev;
     seg->current = (byte*)seg + sizeof(Segment);
+    seg->size = size;
+    seg->isHugePage = isHugePage;
     return seg;
 }
 
+void BumpAllocator::freeSegment(Segment* seg) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    if (seg->isHugePage) {
+        munmap(seg, seg->size);
+        return;
+    }
+#endif
+    ::operator delete(seg);
+}
+
 } // namespace slang
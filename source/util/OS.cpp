@@ -26,6 +26,7 @@
 #    include <io.h>
 #else
 #    include <fcntl.h>
+#    include <sys/mman.h>
 #    include <sys/stat.h>
 #    include <unistd.h>
 #endif
@@ -177,6 +178,64 @@ std::error_code OS::readFile(const fs::path& path, SmallVector<char>& buffer) {
     return ec;
 }
 
+std::error_code OS::mapFile(const fs::path& path, MappedFile& result) {
+    auto& pathStr = path.native();
+    if (pathStr == L"-")
+        return make_error_code(std::errc::not_supported);
+
+    HANDLE handle = ::CreateFileW(pathStr.c_str(), GENERIC_READ,
+                                  FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+                                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        std::error_code ec;
+        DWORD lastErr = ::GetLastError();
+        if (lastErr == ERROR_ACCESS_DENIED && fs::is_directory(path, ec))
+            return make_error_code(std::errc::is_a_directory);
+
+        return std::error_code(lastErr, std::system_category());
+    }
+
+    auto guard = ScopeGuard([handle] { ::CloseHandle(handle); });
+
+    BY_HANDLE_FILE_INFORMATION fileInfo;
+    if (::GetFileType(handle) != FILE_TYPE_DISK ||
+        !::GetFileInformationByHandle(handle, &fileInfo)) {
+        return make_error_code(std::errc::not_supported);
+    }
+
+    // We rely on the zero-filled tail of the last page to provide
+    // the null terminator, so there must be at least one byte of it.
+    SYSTEM_INFO sysInfo;
+    ::GetSystemInfo(&sysInfo);
+    size_t fileSize = (size_t(fileInfo.nFileSizeHigh) << 32) + fileInfo.nFileSizeLow;
+    if (fileSize == 0 || fileSize % sysInfo.dwPageSize == 0)
+        return make_error_code(std::errc::not_supported);
+
+    HANDLE mapping = ::CreateFileMappingW(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping)
+        return std::error_code(::GetLastError(), std::system_category());
+
+    // The view keeps the mapping alive on its own.
+    auto view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    DWORD lastErr = ::GetLastError();
+    ::CloseHandle(mapping);
+    if (!view)
+        return std::error_code(lastErr, std::system_category());
+
+    result.unmap();
+    result.base = view;
+    result.size = fileSize + 1;
+    return {};
+}
+
+void MappedFile::unmap() {
+    if (base) {
+        ::UnmapViewOfFile(base);
+        base = nullptr;
+        size = 0;
+    }
+}
+
 #else
 
 void OS::setupConsole() {
@@ -284,8 +343,74 @@ std::error_code OS::readFile(const fs::path& path, SmallVector<char>& buffer) {
     return ec;
 }
 
+std::error_code OS::mapFile(const fs::path& path, MappedFile& result) {
+    auto& pathStr = path.native();
+    if (pathStr == "-")
+        return make_error_code(std::errc::not_supported);
+
+    int fd;
+    while (true) {
+        fd = ::open(pathStr.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd >= 0)
+            break;
+
+        if (errno != EINTR)
+            return std::error_code(errno, std::generic_category());
+    }
+
+    auto guard = ScopeGuard([fd] { ::close(fd); });
+
+    struct stat status;
+    if (::fstat(fd, &status) != 0)
+        return std::error_code(errno, std::generic_category());
+
+    if (!S_ISREG(status.st_mode))
+        return make_error_code(std::errc::not_supported);
+
+    // We rely on the zero-filled tail of the last page to provide
+    // the null terminator, so there must be at least one byte of it.
+    static const size_t pageSize = size_t(::sysconf(_SC_PAGESIZE));
+    auto fileSize = (size_t)status.st_size;
+    if (fileSize == 0 || fileSize % pageSize == 0)
+        return make_error_code(std::errc::not_supported);
+
+    void* mem = ::mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mem == MAP_FAILED)
+        return std::error_code(errno, std::generic_category());
+
+    result.unmap();
+    result.base = mem;
+    result.size = fileSize + 1;
+    return {};
+}
+
+void MappedFile::unmap() {
+    if (base) {
+        ::munmap(const_cast<void*>(base), size - 1);
+        base = nullptr;
+        size = 0;
+    }
+}
+
 #endif
 
+MappedFile::MappedFile(MappedFile&& other) noexcept :
+    base(std::exchange(other.base, nullptr)), size(std::exchange(other.size, 0)) {
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        unmap();
+        base = std::exchange(other.base, nullptr);
+        size = std::exchange(other.size, 0);
+    }
+    return *this;
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
 void OS::writeFile(const fs::path& path, std::string_view contents) {
     if (path == "-") {
         std::cout.write(contents.data(), (std::streamsize)contents.size());
@@ -57,9 +57,16 @@ struct Entry {
     std::string detail;
 };
 
+struct CounterEntry {
+    time_point<steady_clock> time;
+    std::string name;
+    std::vector<std::pair<std::string, uint64_t>> values;
+};
+
 struct TimeTrace::Profiler {
     static thread_local std::vector<Entry> stack;
     std::vector<Entry> entries;
+    std::vector<CounterEntry> counters;
     time_point<steady_clock> startTime;
     std::mutex mut;
 
@@ -89,6 +96,16 @@ struct TimeTrace::Profiler {
         stack.pop_back();
     }
 
+    void add(Entry&& entry) {
+        std::scoped_lock lock(mut);
+        entries.emplace_back(std::move(entry));
+    }
+
+    void add(CounterEntry&& entry) {
+        std::scoped_lock lock(mut);
+        counters.emplace_back(std::move(entry));
+    }
+
     void write(std::ostream& os) {
         SLANG_ASSERT(stack.empty());
         std::scoped_lock lock(mut);
@@ -118,6 +135,20 @@ struct TimeTrace::Profiler {
                               escapeString(entry.detail));
         }
 
+        for (auto& counter : counters) {
+            std::string args;
+            for (auto& [name, value] : counter.values) {
+                if (!args.empty())
+                    args += ", ";
+                args += fmt::format("\"{}\":{}", escapeString(name), value);
+            }
+
+            auto timeUs = duration_cast<microseconds>(counter.time - startTime).count();
+            os << fmt::format("{{ \"pid\":1, \"tid\":0, \"ph\":\"C\", \"ts\":{}, "
+                              "\"name\":\"{}\", \"args\":{{ {} }} }},\n",
+                              timeUs, escapeString(counter.name), args);
+        }
+
         // Emit metadata event with process name.
         os << "{ \"cat\":\"\", \"pid\":1, \"tid\":0, \"ts\":0, \"ph\":\"M\", "
               "\"name\":\"process_name\", \"args\":{ \"name\":\"slang\" } }\n";
@@ -152,4 +183,23 @@ void TimeTrace::endTrace() {
         profiler->end();
 }
 
+void TimeTrace::addSection(std::string_view name, std::string_view detail,
+                           std::thread::id threadId, steady_clock::time_point start,
+                           steady_clock::duration duration) {
+    if (profiler) {
+        profiler->add(
+            Entry{start, duration, threadId, std::string(name), std::string(detail)});
+    }
+}
+
+void TimeTrace::addCounter(std::string_view name,
+                           std::initializer_list<std::pair<std::string_view, uint64_t>> values) {
+    if (profiler) {
+        CounterEntry entry{steady_clock::now(), std::string(name), {}};
+        for (auto& [valueName, value] : values)
+            entry.values.emplace_back(std::string(valueName), value);
+        profiler->add(std::move(entry));
+    }
+}
+
 } // namespace slang
@@ -0,0 +1,13 @@
+module leaf;
+endmodule
+
+module mid;
+    leaf c();
+endmodule
+
+// The first sibling's name is a prefix of the second's, so matching
+// --inst-prefix top.u2 has to backtrack after rejecting u.
+module top;
+    mid u();
+    mid u2();
+endmodule
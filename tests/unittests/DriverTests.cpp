@@ -254,6 +254,53 @@ TEST_CASE("Driver single-unit parsing files with no EOL") {
     CHECK(driver.reportParseDiags());
 }
 
+TEST_CASE("Driver preprocessor snapshots") {
+    std::error_code ec;
+    auto snapshotPath =
+        (std::filesystem::temp_directory_path(ec) / "slang_pp_snapshot.svh").string();
+
+    {
+        Driver driver;
+        driver.addStandardArgs();
+
+        auto args = fmt::format("testfoo \"{0}file_uses_define_in_file_with_no_eol.sv\" "
+                                "--prefix-header \"{0}file_with_no_eol.sv\" "
+                                "--save-pp-snapshot \"{1}\"",
+                                findTestDir(), snapshotPath);
+        CHECK(driver.parseCommandLine(args));
+        CHECK(driver.processOptions());
+        CHECK(driver.parseAllSources());
+        CHECK(driver.reportParseDiags());
+    }
+
+    {
+        Driver driver;
+        driver.addStandardArgs();
+
+        auto args = fmt::format("testfoo \"{0}file_uses_define_in_file_with_no_eol.sv\" "
+                                "--load-pp-snapshot \"{1}\"",
+                                findTestDir(), snapshotPath);
+        CHECK(driver.parseCommandLine(args));
+        CHECK(driver.processOptions());
+        CHECK(driver.parseAllSources());
+        CHECK(driver.reportParseDiags());
+    }
+
+    std::filesystem::remove(snapshotPath, ec);
+}
+
+TEST_CASE("Driver preprocessor snapshot option errors") {
+    auto guard = OS::captureOutput();
+
+    Driver driver;
+    driver.addStandardArgs();
+
+    auto args = fmt::format("testfoo \"{0}test.sv\" --save-pp-snapshot foo.svh", findTestDir());
+    CHECK(driver.parseCommandLine(args));
+    CHECK(!driver.processOptions());
+    CHECK(stderrContains("--prefix-header must be set"));
+}
+
 TEST_CASE("Driver parsing with library modules") {
     auto guard = OS::captureOutput();
 
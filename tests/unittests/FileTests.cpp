@@ -6,6 +6,7 @@
 
 #include "slang/text/Glob.h"
 #include "slang/text/SourceManager.h"
+#include "slang/util/OS.h"
 #include "slang/util/String.h"
 
 std::string getTestInclude() {
@@ -23,6 +24,24 @@ TEST_CASE("Read source") {
     CHECK(file->data.length() > 0);
 }
 
+TEST_CASE("Read source (memory mapped)") {
+    SourceManager manager;
+    manager.setMemoryMapFiles(true);
+    std::string testPath = getTestInclude();
+
+    CHECK(!manager.readSource("X:\\nonsense.txt", /* library */ nullptr));
+
+    auto file = manager.readSource(testPath, /* library */ nullptr);
+    REQUIRE(file);
+    REQUIRE(file->data.length() > 0);
+    CHECK(file->data.back() == '\0');
+
+    SmallVector<char> expected;
+    REQUIRE(!OS::readFile(testPath, expected));
+    CHECK(file->data == std::string_view(expected.data(), expected.size()));
+    CHECK(manager.getSourceText(file->id) == file->data);
+}
+
 TEST_CASE("Read header (absolute)") {
     SourceManager manager;
     std::string testPath = getTestInclude();
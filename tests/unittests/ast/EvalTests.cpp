@@ -6,7 +6,14 @@
 #include <cmath>
 using Catch::Approx;
 
+#include "slang/ast/ConstantBytecode.h"
 #include "slang/ast/ScriptSession.h"
+#include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/InstanceSymbols.h"
+#include "slang/ast/symbols/ParameterSymbols.h"
+#include "slang/ast/symbols/SubroutineSymbols.h"
+#include "slang/ast/symbols/VariableSymbols.h"
+#include "slang/ast/types/Type.h"
 
 TEST_CASE("Simple eval") {
     ScriptSession session;
@@ -2540,3 +2547,374 @@ TEST_CASE("Array map eval") {
 
     NO_SESSION_ERRORS;
 }
+
+TEST_CASE("Constant function bytecode") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    function automatic logic [31:0] crc32(logic [31:0] data, int n);
+        logic [31:0] crc = '1;
+        for (int i = 0; i < n; i++) begin
+            crc ^= data << i;
+            repeat (8) begin
+                if (crc[0])
+                    crc = (crc >> 1) ^ 32'hedb88320;
+                else
+                    crc = crc >> 1;
+            end
+        end
+        return ~crc;
+    endfunction
+
+    function automatic int clog2(longint v);
+        int r = 0;
+        v--;
+        while (v > 0) begin
+            r++;
+            v >>= 1;
+        end
+        return r;
+    endfunction
+
+    function automatic int fib(int n);
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    endfunction
+
+    function automatic int loops(int n);
+        int total = 0;
+        int i = 0;
+        do begin
+            i += 1;
+            if (i % 3 == 0) continue;
+            case (i % 5)
+                0: total += 100;
+                4: if (i > 10) break;
+                default: total += i;
+            endcase
+        end while (i < n);
+        forever begin
+            total--;
+            if (total < 50 || n == 0) break;
+        end
+        return total + i;
+    endfunction
+
+    function automatic int tableSum(int n);
+        int t[16];
+        int sum;
+        foreach (t[j]) t[j] = j * n;
+        for (int k = 0; k < 16; k += 2)
+            sum += t[k] > 20 && t[k] < 100 ? t[k] : -1;
+        return sum;
+    endfunction
+
+    function automatic logic [3:0] merge(logic c);
+        return c ? 4'b1010 : 4'b1001;
+    endfunction
+
+    function automatic real mixed(int n);
+        real r = 1.5;
+        for (int i = 0; i < n; ++i)
+            r = r * 2 - real'(i);
+        return r;
+    endfunction
+endpackage
+
+module m;
+    import p::*;
+    localparam logic [31:0] c1 = crc32(32'hdeadbeef, 4);
+    localparam int c2 = clog2(1000);
+    localparam int c3 = fib(10);
+    localparam int c4 = loops(20);
+    localparam int c5 = tableSum(7);
+    localparam logic [3:0] c6 = merge(1'bx);
+    localparam real c7 = mixed(5);
+endmodule
+)");
+
+    auto getValues = [&](bitmask<CompilationFlags> flags) {
+        CompilationOptions co;
+        co.flags |= flags;
+        Bag options;
+        options.set(co);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(tree);
+        NO_COMPILATION_ERRORS;
+
+        auto& pkg = *compilation.getPackage("p");
+        auto bytecode = pkg.find<SubroutineSymbol>("crc32").getConstantBytecode();
+        CHECK(bytecode);
+        CHECK(!bytecode->instructions.empty());
+
+        std::vector<std::string> results;
+        auto& m = compilation.getRoot().lookupName<InstanceSymbol>("m").body;
+        for (auto name : {"c1", "c2", "c3", "c4", "c5", "c6", "c7"})
+            results.push_back(m.find<ParameterSymbol>(name).getValue().toString());
+        return results;
+    };
+
+    auto tree1 = getValues({});
+    auto tree2 = getValues(CompilationFlags::ConstexprBytecode);
+    CHECK(tree1 == tree2);
+    CHECK(tree2[1] == "10");
+    CHECK(tree2[2] == "55");
+    CHECK(tree2[5] == "4'b10xx");
+}
+
+TEST_CASE("Constant function bytecode step limit") {
+    auto tree = SyntaxTree::fromText(R"(
+function automatic int spin(int n);
+    int x = 0;
+    for (int i = 0; i < n; i++) begin
+        case (i % 3)
+            0: x += i;
+            default: x--;
+        endcase
+        if (x > 100)
+            x = 0;
+    end
+    return x;
+endfunction
+
+module m;
+    localparam int p = spin(50);
+endmodule
+)");
+
+    auto succeeds = [&](bitmask<CompilationFlags> flags, uint32_t maxSteps) {
+        CompilationOptions co;
+        co.flags |= flags;
+        co.maxConstexprSteps = maxSteps;
+        Bag options;
+        options.set(co);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(tree);
+
+        auto& diags = compilation.getAllDiagnostics();
+        for (auto& diag : diags) {
+            if (diag.code != diag::ConstEvalExceededMaxSteps)
+                FAIL_CHECK(report(diags));
+        }
+        return diags.empty();
+    };
+
+    // Find the smallest step limit that lets the tree walker finish and
+    // make sure the bytecode agrees on it exactly.
+    uint32_t lo = 1, hi = 4096;
+    REQUIRE(succeeds({}, hi));
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (succeeds({}, mid))
+            hi = mid;
+        else
+            lo = mid + 1;
+    }
+
+    CHECK(succeeds(CompilationFlags::ConstexprBytecode, lo));
+    CHECK(!succeeds(CompilationFlags::ConstexprBytecode, lo - 1));
+}
+
+TEST_CASE("Constant function memoization") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    function automatic int clog2(int v);
+        int r = 0;
+        v--;
+        while (v > 0) begin
+            r++;
+            v >>= 1;
+        end
+        return r;
+    endfunction
+
+    function automatic int twice(int v);
+        return clog2(v) * 2;
+    endfunction
+
+    function automatic int withOut(int v, output int o);
+        o = v;
+        return v;
+    endfunction
+
+    function automatic int wrapOut(int v);
+        int o;
+        return withOut(v, o) + o;
+    endfunction
+
+    int counter;
+    function automatic int readsVar(int v);
+        return v + counter;
+    endfunction
+
+    function automatic real half(real r);
+        return r / 2;
+    endfunction
+
+    function automatic int fib(int n);
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    endfunction
+
+    function automatic int isEven(int n);
+        return n == 0 ? 1 : isOdd(n - 1);
+    endfunction
+
+    function automatic int isOdd(int n);
+        return n == 0 ? 0 : isEven(n - 1);
+    endfunction
+endpackage
+
+module m #(parameter int W = 8);
+    import p::*;
+
+    function automatic int addW(int v);
+        return v + W;
+    endfunction
+
+    localparam int a = clog2(W);
+    localparam int b = twice(W);
+    localparam real d = half(W);
+    localparam int e = fib(20);
+    localparam int f = isEven(W);
+    localparam int g = addW(1);
+endmodule
+
+module top;
+    m #(100) m1();
+    m #(100) m2();
+    m #(7) m3();
+endmodule
+)");
+
+    auto getValues = [&](uint32_t maxMemo, Compilation::ConstantMemoStats& stats) {
+        CompilationOptions co;
+        co.maxConstexprMemo = maxMemo;
+        Bag options;
+        options.set(co);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(tree);
+        NO_COMPILATION_ERRORS;
+
+        auto& pkg = *compilation.getPackage("p");
+        for (auto name : {"clog2", "twice", "half", "fib"})
+            CHECK(pkg.find<SubroutineSymbol>(name).isMemoizable());
+        for (auto name : {"withOut", "wrapOut", "readsVar", "isEven", "isOdd"})
+            CHECK(!pkg.find<SubroutineSymbol>(name).isMemoizable());
+
+        std::vector<std::string> results;
+        auto& root = compilation.getRoot();
+        for (auto inst : {"top.m1", "top.m2", "top.m3"}) {
+            auto& body = root.lookupName<InstanceSymbol>(inst).body;
+            for (auto name : {"a", "b", "d", "e", "f", "g"})
+                results.push_back(body.find<ParameterSymbol>(name).getValue().toString());
+        }
+
+        stats = compilation.getConstantMemoStats();
+        return results;
+    };
+
+    Compilation::ConstantMemoStats stats;
+    auto memoized = getValues(16384, stats);
+    CHECK(stats.hits > 0);
+    CHECK(stats.misses > 0);
+    CHECK(stats.entries > 0);
+
+    auto uncached = getValues(0, stats);
+    CHECK(stats.hits == 0);
+    CHECK(stats.misses == 0);
+    CHECK(stats.entries == 0);
+
+    CHECK(memoized == uncached);
+    CHECK(memoized[0] == "7");
+    CHECK(memoized[3] == "6765");
+    CHECK(memoized[5] == "101");
+    CHECK(memoized[12] == "3");
+    CHECK(memoized[17] == "8");
+
+    // Only a limited number of results get recorded.
+    getValues(4, stats);
+    CHECK(stats.entries == 4);
+}
+
+TEST_CASE("Constant function memoization step limit") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function automatic int sum(int n);
+        int r = 0;
+        for (int i = 0; i < n; i++)
+            r += i;
+        return r;
+    endfunction
+
+    localparam int a = sum(100);
+    localparam int b = sum(100) + sum(100);
+endmodule
+)");
+
+    auto getErrors = [&](uint32_t maxMemo, uint32_t maxSteps) {
+        CompilationOptions co;
+        co.maxConstexprMemo = maxMemo;
+        co.maxConstexprSteps = maxSteps;
+        Bag options;
+        options.set(co);
+
+        Compilation compilation(options);
+        compilation.addSyntaxTree(tree);
+
+        size_t count = 0;
+        for (auto& diag : compilation.getAllDiagnostics()) {
+            if (diag.code == diag::ConstEvalExceededMaxSteps)
+                count++;
+        }
+        return count;
+    };
+
+    // Memoized calls are charged the steps they originally took, so the
+    // limit is hit in exactly the same places with and without the memo.
+    bool sawPartial = false;
+    for (uint32_t maxSteps = 100; maxSteps <= 2000; maxSteps += 100) {
+        auto errors = getErrors(16384, maxSteps);
+        CHECK(errors == getErrors(0, maxSteps));
+        sawPartial |= errors == 1;
+    }
+    CHECK(sawPartial);
+}
+
+TEST_CASE("Constant function memoization eval flags") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    function automatic int inc(int v);
+        return v + 1;
+    endfunction
+
+    localparam int p1 = inc(1);
+    localparam int p2 = inc(1);
+    specparam s = inc(1);
+    logic [inc(1):0] v;
+endmodule
+)");
+
+    CompilationOptions co;
+    co.maxConstexprMemo = 16384;
+    Bag options;
+    options.set(co);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& m = compilation.getRoot().lookupName<InstanceSymbol>("m").body;
+    CHECK(m.find<ParameterSymbol>("p1").getValue().integer() == 2);
+    CHECK(m.find<ParameterSymbol>("p2").getValue().integer() == 2);
+    CHECK(m.find<SpecparamSymbol>("s").getValue().integer() == 2);
+    CHECK(m.find<VariableSymbol>("v").getType().getBitWidth() == 3);
+
+    // Parameter initializers, specparam initializers, and type dimensions are
+    // evaluated with different flags, so each of them needs its own entry even
+    // though the call is the same. The second parameter reuses the first's.
+    auto stats = compilation.getConstantMemoStats();
+    CHECK(stats.misses == 3);
+    CHECK(stats.entries == 3);
+    CHECK(stats.hits >= 1);
+}
@@ -8,6 +8,7 @@
 #include "slang/ast/symbols/InstanceSymbols.h"
 #include "slang/ast/symbols/MemberSymbols.h"
 #include "slang/ast/symbols/ParameterSymbols.h"
+#include "slang/ast/types/Type.h"
 #include "slang/text/SourceManager.h"
 
 TEST_CASE("Finding top level") {
@@ -1827,3 +1828,190 @@ endmodule
     CHECK(diags[0].code == diag::VirtualIfaceDefparam);
     CHECK(diags[1].code == diag::VirtualIfaceDefparam);
 }
+
+TEST_CASE("Identical instances share elaboration") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int P);
+    if (P == 1) begin
+        $warning("one");
+    end
+    else begin
+        $warning("two");
+    end
+endmodule
+
+module n;
+    m #(1) m1();
+endmodule
+
+module top;
+    m #(1) a();
+    m #(1) b();
+    m #(2) c();
+    n n1();
+    n n2();
+endmodule
+)");
+
+    CompilationOptions options;
+    options.flags |= CompilationFlags::EnableInstanceCaching;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 2);
+    CHECK(diags[0].coalesceCount == 4);
+    CHECK(diags[1].coalesceCount == 1);
+
+    auto& root = compilation.getRoot();
+    auto& a = root.lookupName<InstanceSymbol>("top.a");
+    CHECK(!a.getCanonicalBody());
+    CHECK(a.body.getNumSharedInstances() == 3);
+    CHECK(root.lookupName<InstanceSymbol>("top.b").getCanonicalBody() == &a.body);
+    CHECK(!root.lookupName<InstanceSymbol>("top.c").getCanonicalBody());
+    CHECK(root.lookupName<InstanceSymbol>("top.n2").getCanonicalBody() ==
+          &root.lookupName<InstanceSymbol>("top.n1").body);
+}
+
+TEST_CASE("Instance sharing with hierarchical references") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    logic v;
+    always_comb v = 1;
+endmodule
+
+module up;
+    logic w;
+    assign w = top.x;
+endmodule
+
+module top;
+    logic x;
+    m a();
+    m b();
+    up u1();
+    up u2();
+    assign b.v = 0;
+endmodule
+)");
+
+    CompilationOptions options;
+    options.flags |= CompilationFlags::EnableInstanceCaching;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::MixedVarAssigns);
+
+    auto& root = compilation.getRoot();
+    CHECK(!root.lookupName<InstanceSymbol>("top.b").getCanonicalBody());
+    CHECK(!root.lookupName<InstanceSymbol>("top.u2").getCanonicalBody());
+}
+
+TEST_CASE("Instance sharing is off by default") {
+    auto tree = SyntaxTree::fromText(R"(
+module m;
+    logic v;
+endmodule
+
+module top;
+    m a();
+    m b();
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto& root = compilation.getRoot();
+    CHECK(!root.lookupName<InstanceSymbol>("top.b").getCanonicalBody());
+    CHECK(root.lookupName<InstanceSymbol>("top.a").body.getNumSharedInstances() == 0);
+}
+
+TEST_CASE("Instances that drive external symbols are not shared") {
+    auto checkDesign = [](DiagCode expected, std::string_view text) {
+        for (auto flags : {CompilationFlags::None, CompilationFlags::EnableInstanceCaching}) {
+            auto tree = SyntaxTree::fromText(text);
+            CompilationOptions options;
+            options.flags |= flags;
+
+            Compilation compilation(options);
+            compilation.addSyntaxTree(tree);
+
+            auto& diags = compilation.getAllDiagnostics();
+            REQUIRE(diags.size() == 1);
+            CHECK(diags[0].code == expected);
+
+            auto& top = *compilation.getRoot().topInstances[0];
+            CHECK(!top.body.find<InstanceSymbol>("b").getCanonicalBody());
+        }
+    };
+
+    checkDesign(diag::MultipleAlwaysAssigns, R"(
+package p;
+    logic x;
+endpackage
+
+module m;
+    always_comb p::x = 1;
+endmodule
+
+module top;
+    m a();
+    m b();
+endmodule
+)");
+
+    checkDesign(diag::MultipleContAssigns, R"(
+logic y;
+
+module m2;
+    assign y = 1;
+endmodule
+
+module top2;
+    m2 a();
+    m2 b();
+endmodule
+)");
+}
+
+TEST_CASE("Hierarchy-only elaboration") {
+    auto tree = SyntaxTree::fromText(R"(
+module m #(parameter int P = 1, parameter type T = logic);
+    T v;
+    always_comb v = undeclared + P;
+endmodule
+
+module top;
+    localparam int N = 3;
+    for (genvar i = 0; i < N; i++) begin : gen
+        m #(.P(i * 2), .T(logic [i:0])) u();
+    end
+
+    initial $display(foo);
+    unknown_mod x();
+endmodule
+)");
+
+    CompilationOptions options;
+    options.flags |= CompilationFlags::HierarchyOnly;
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+
+    // Errors in statements and expressions aren't found because they're never
+    // bound, but problems with the hierarchy itself are still reported.
+    auto& diags = compilation.getAllDiagnostics();
+    REQUIRE(diags.size() == 1);
+    CHECK(diags[0].code == diag::UnknownModule);
+
+    auto& root = compilation.getRoot();
+    auto& u = root.lookupName<InstanceSymbol>("top.gen[2].u");
+    CHECK(u.body.find<ParameterSymbol>("P").getValue().integer() == 4);
+    CHECK(u.body.find<TypeParameterSymbol>("T").targetType.getType().toString() == "logic[2:0]");
+}
@@ -338,6 +338,55 @@ endmodule
     writer.view();
 }
 
+TEST_CASE("JSON dump -- streamed output") {
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+    typedef struct packed { logic [3:0] a; logic b; } S;
+endpackage
+
+module m #(parameter int W = 4) (input logic [W-1:0] i, output logic [W-1:0] o);
+    p::S s;
+    always_comb begin
+        if (i[0]) o = i;
+        else o = '0;
+    end
+endmodule
+
+module top;
+    logic [7:0] a, b;
+    m #(8) u(.i(a), .o(b));
+    for (genvar g = 0; g < 2; g++) begin : gen
+        int x [2];
+    end
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    auto serialize = [&](bool pretty, size_t bufferSize) {
+        std::string streamed;
+        JsonWriter writer;
+        writer.setPrettyPrint(pretty);
+        if (bufferSize)
+            writer.setOutput([&](std::string_view text) { streamed += text; }, bufferSize);
+
+        ASTSerializer serializer(compilation, writer);
+        serializer.serialize(compilation.getRoot());
+        writer.flush();
+        return streamed + std::string(writer.view());
+    };
+
+    // Streaming through any size of buffer gives the same text as
+    // building the whole document in memory.
+    for (bool pretty : {false, true}) {
+        auto expected = serialize(pretty, 0);
+        for (size_t bufferSize : {1, 7, 64, 4096})
+            CHECK(serialize(pretty, bufferSize) == expected);
+    }
+}
+
 TEST_CASE("JSON dump -- types and values") {
     auto tree = SyntaxTree::fromText(R"(
 module test_enum;
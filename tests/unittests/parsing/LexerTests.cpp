@@ -243,6 +243,45 @@ TEST_CASE("Newlines (LF)") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Long runs of trivia, identifiers, and strings") {
+    // Runs of characters are scanned in blocks, so shift everything through
+    // all of the possible alignments relative to the start of the buffer.
+    std::string ident = "Abc_$" + std::string(40, 'z') + "0123456789_Q$";
+    std::string body = std::string(50, 'x') + "* / \xc3\xa9" + std::string(20, 'y');
+    std::string str = std::string(45, 's') + "\\n" + std::string(20, 't');
+    std::string lineComment = "// trailing " + std::string(40, 'c') + "\xe2\x82\xac end";
+
+    for (size_t pad = 0; pad < 40; pad++) {
+        std::string text = std::string(pad, ' ') + "/*" + body + "*/\t\v\f" + ident + " \"" +
+                           str + "\" " + lineComment + "\n" + ident;
+
+        diagnostics.clear();
+        auto buffer = getSourceManager().assignText(text);
+        Lexer lexer(buffer, alloc, diagnostics);
+
+        Token token = lexer.lex();
+        CHECK(token.kind == TokenKind::Identifier);
+        CHECK(token.valueText() == ident);
+        REQUIRE(token.trivia().size() == (pad ? 3 : 2));
+        CHECK(token.trivia()[pad ? 1 : 0].getRawText() == "/*" + body + "*/");
+        CHECK(token.trivia().back().getRawText() == "\t\v\f");
+
+        token = lexer.lex();
+        CHECK(token.kind == TokenKind::StringLiteral);
+        CHECK(token.valueText() == std::string(45, 's') + "\n" + std::string(20, 't'));
+
+        token = lexer.lex();
+        CHECK(token.kind == TokenKind::Identifier);
+        CHECK(token.valueText() == ident);
+        REQUIRE(token.trivia().size() == 3);
+        CHECK(token.trivia()[1].getRawText() == lineComment);
+
+        token = lexer.lex();
+        CHECK(token.kind == TokenKind::EndOfFile);
+        CHECK_DIAGNOSTICS_EMPTY;
+    }
+}
+
 TEST_CASE("Simple Identifiers") {
     auto& text = "abc";
     Token token = lexToken(text);
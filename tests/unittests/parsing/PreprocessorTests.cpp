@@ -97,6 +97,154 @@ TEST_CASE("Double include, with pragma once") {
     CHECK_DIAGNOSTICS_EMPTY;
 }
 
+TEST_CASE("Double include, with include guard") {
+    SourceManager sm;
+    sm.assignText("guarded.svh", R"(// Comments outside the guard are fine
+`ifndef GUARDED_SVH
+`define GUARDED_SVH
+`ifdef FOO
+"foo"
+`else
+"guarded"
+`endif
+`endif // GUARDED_SVH
+)");
+    sm.assignText("not-guarded1.svh", R"(
+`ifndef NOT_GUARDED1
+`define NOT_GUARDED1
+"in guard"
+`endif
+"after guard"
+)");
+    sm.assignText("not-guarded2.svh", R"(
+`ifndef NOT_GUARDED2
+`define NOT_GUARDED2
+"in guard"
+`else
+"in else"
+`endif
+)");
+    sm.assignText("not-guarded3.svh", R"(
+`ifdef NOT_GUARDED3
+`else
+`define NOT_GUARDED3
+"in guard"
+`endif
+)");
+
+    auto run = [&](std::string_view text, uint32_t expectedSkips) {
+        Diagnostics diags;
+        Preprocessor preprocessor(sm, alloc, diags);
+        preprocessor.pushSource(sm.assignText(text));
+
+        std::string result;
+        while (true) {
+            Token token = preprocessor.next();
+            if (token.kind == TokenKind::EndOfFile)
+                break;
+            result += token.valueText();
+            result += ' ';
+        }
+
+        CHECK(diags.empty());
+        CHECK(preprocessor.getNumSkippedIncludes() == expectedSkips);
+        return result;
+    };
+
+    CHECK(run(R"(
+`include "guarded.svh"
+`include "guarded.svh"
+`include "guarded.svh"
+)",
+              2) == "guarded ");
+
+    // Undefining the guard macro makes the header get included again.
+    CHECK(run(R"(
+`include "guarded.svh"
+`undef GUARDED_SVH
+`include "guarded.svh"
+`include "guarded.svh"
+)",
+              1) == "guarded guarded ");
+
+    // Files with anything outside of the guard block are not considered guarded.
+    CHECK(run(R"(
+`include "not-guarded1.svh"
+`include "not-guarded1.svh"
+`include "not-guarded2.svh"
+`include "not-guarded2.svh"
+`include "not-guarded3.svh"
+`include "not-guarded3.svh"
+)",
+              0) == "in guard after guard after guard in guard in else in guard ");
+}
+
+TEST_CASE("Preprocessor snapshots") {
+    auto& header = R"(
+`define FOO 42
+`define BAR(a, b) a + \
+    b
+`include "include_once.svh"
+`include "include_guard.svh"
+`define BAZ(x) `"x`"
+module m; endmodule
+)";
+
+    auto& sm = getSourceManager();
+    auto headerBuffer = sm.assignText(header);
+
+    Diagnostics diags;
+    auto snapshot = PreprocessorSnapshot::fromBuffers(sm, std::span(&headerBuffer, 1), diags);
+    CHECK(diags.empty());
+    REQUIRE(snapshot->macros.size() == 5);
+    CHECK(snapshot->macros[0]->name.valueText() == "BAR");
+    CHECK(snapshot->macros[1]->name.valueText() == "BAZ");
+    CHECK(snapshot->macros[2]->name.valueText() == "FOO");
+    CHECK(snapshot->macros[3]->name.valueText() == "GUARDED_MACRO");
+    CHECK(snapshot->macros[4]->name.valueText() == "INCLUDE_GUARD_SVH");
+    REQUIRE(snapshot->includeOnceHeaders.size() == 1);
+    CHECK(snapshot->includeOnceHeaders[0].ends_with("include_once.svh"));
+    REQUIRE(snapshot->includeGuards.size() == 1);
+    CHECK(snapshot->includeGuards[0].first.ends_with("include_guard.svh"));
+    CHECK(snapshot->includeGuards[0].second == "INCLUDE_GUARD_SVH");
+
+    auto& text = R"(
+`include "include_once.svh"
+`include "include_guard.svh"
+`FOO `BAR(1, 2) `BAZ(hello)
+)";
+    auto& expected = R"(
+42 1 +
+    2 "hello"
+)";
+
+    PreprocessorOptions ppOptions;
+    ppOptions.snapshot = snapshot;
+    Bag options;
+    options.set(ppOptions);
+
+    std::string result = preprocess(text, options);
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+
+    // Round trip through the serialized form.
+    auto serialized = snapshot->serialize();
+    auto snapshotBuffer = sm.assignText(serialized);
+    auto loaded = PreprocessorSnapshot::deserialize(sm, snapshotBuffer, diags);
+    CHECK(diags.empty());
+    REQUIRE(loaded->macros.size() == 5);
+    CHECK(loaded->includeOnceHeaders == snapshot->includeOnceHeaders);
+    CHECK(loaded->includeGuards == snapshot->includeGuards);
+    CHECK(loaded->serialize() == serialized);
+
+    ppOptions.snapshot = loaded;
+    options.set(ppOptions);
+
+    result = preprocess(text, options);
+    CHECK(result == expected);
+    CHECK_DIAGNOSTICS_EMPTY;
+}
+
 TEST_CASE("Include directive errors") {
     auto& text = R"(
 `include
@@ -4,6 +4,7 @@
 #include "Test.h"
 #include <catch2/catch_approx.hpp>
 #include <cmath>
+#include <random>
 #include <sstream>
 using Catch::Approx;
 
@@ -834,3 +835,138 @@ value = value >> 1
     compilation.addSyntaxTree(tree);
     compilation.getAllDiagnostics();
 }
+
+TEST_CASE("SVInt single word fast paths") {
+    // Results for values that fit in a single word should match the same
+    // operation done at a multi-word width and then truncated back down.
+    std::mt19937_64 rng(12345);
+    for (int i = 0; i < 2000; i++) {
+        auto width = bitwidth_t(rng() % 64 + 1);
+        auto mask = width == 64 ? UINT64_MAX : (1ull << width) - 1;
+        auto iw = int32_t(width);
+
+        SVInt a(width, rng() & mask, false);
+        SVInt b(width, rng() & mask, false);
+        auto wa = a.extend(130, false);
+        auto wb = b.extend(130, false);
+
+        CHECK(a + b == (wa + wb).slice(iw - 1, 0));
+        CHECK(a - b == (wa - wb).slice(iw - 1, 0));
+        CHECK(a * b == (wa * wb).slice(iw - 1, 0));
+        CHECK(exactlyEqual(a < b, wa < wb));
+
+        auto amount = bitwidth_t(rng() % width);
+        CHECK(a.shl(amount) == wa.shl(amount).slice(iw - 1, 0));
+        CHECK(a.lshr(amount) == wa.lshr(amount).slice(iw - 1, 0));
+        CHECK(a.ashr(amount) == a.lshr(amount));
+
+        SVInt sa = a;
+        SVInt sb = b;
+        sa.setSigned(true);
+        sb.setSigned(true);
+        auto wsa = sa.extend(130, true);
+        auto wsb = sb.extend(130, true);
+        CHECK(exactlyEqual(sa < sb, wsa < wsb));
+        CHECK(sa.ashr(amount) == wsa.ashr(amount).slice(iw - 1, 0));
+
+        auto lsb = int32_t(rng() % width);
+        auto msb = lsb + int32_t(rng() % (width - bitwidth_t(lsb)));
+        CHECK(exactlyEqual(a.slice(msb, lsb), wa.slice(msb, lsb)));
+    }
+}
+
+TEST_CASE("SVInt wide four-state bitwise") {
+    // Check every bit of the wide four-state bitwise operators against
+    // the equivalent logic_t operation.
+    constexpr bitwidth_t Width = 200;
+    std::mt19937_64 rng(12345);
+
+    const logic_t bits[] = {logic_t(0), logic_t(1), logic_t::x, logic_t::z};
+    auto randomValue = [&] {
+        SVInt result(Width, 0, false);
+        for (int32_t i = 0; i < int32_t(Width); i++)
+            result.set(i, i, SVInt(bits[rng() % 4]));
+        return result;
+    };
+
+    auto knownValue = [&] {
+        SVInt result(Width, rng(), false);
+        return result.shl(64) | SVInt(Width, rng(), false);
+    };
+
+    for (int iter = 0; iter < 24; iter++) {
+        auto a = iter % 3 == 2 ? knownValue() : randomValue();
+        auto b = iter % 2 ? randomValue() : knownValue();
+        auto andResult = a & b;
+        auto orResult = a | b;
+        auto xorResult = a ^ b;
+        auto merged = SVInt::conditional(SVInt(logic_t::x), a, b);
+
+        for (int32_t i = 0; i < int32_t(Width); i++) {
+            logic_t l = a[i];
+            logic_t r = b[i];
+            CHECK(exactlyEqual(andResult[i], l & r));
+            CHECK(exactlyEqual(orResult[i], l | r));
+            CHECK(exactlyEqual(xorResult[i], l ^ r));
+
+            logic_t m = !l.isUnknown() && exactlyEqual(l, r) ? l : logic_t::x;
+            CHECK(exactlyEqual(merged[i], m));
+        }
+    }
+}
+
+TEST_CASE("SVInt wide multiply and divide") {
+    // Values big enough to use Karatsuba multiplication and recursive division,
+    // checked against each other and against the division identities.
+    std::mt19937_64 rng(12345);
+    auto randomValue = [&](bitwidth_t width, bitwidth_t activeBits) {
+        SVInt result(width, 0, false);
+        for (bitwidth_t i = 0; i < activeBits; i += 64)
+            result = result.shl(64) | SVInt(width, rng(), false);
+
+        result = result.trunc(activeBits);
+        return activeBits < width ? result.zext(width) : result;
+    };
+
+    constexpr bitwidth_t Width = 12000;
+    for (int i = 0; i < 10; i++) {
+        auto lhsBits = bitwidth_t(rng() % (Width - 64) + 64);
+        auto rhsBits = i % 2 ? bitwidth_t(rng() % lhsBits + 1) : std::max(lhsBits / 2, 1u);
+        auto a = randomValue(Width, lhsBits);
+        auto b = randomValue(Width, rhsBits);
+        if (b == 0)
+            b = SVInt(Width, 3, false);
+
+        auto q = a / b;
+        auto r = a % b;
+        CHECK(q * b + r == a);
+        CHECK(r < b);
+
+        // Unbalanced operand sizes exercise the chunked multiply path.
+        auto wa = a.zext(Width * 2);
+        auto wb = b.zext(Width * 2);
+        auto product = wa * wb;
+        CHECK(product % wb == 0);
+        CHECK(product / wb == wa);
+    }
+}
+
+TEST_CASE("SVInt wide decimal strings") {
+    // Large values get split by powers of ten when converting to decimal;
+    // make sure the results round trip, including interior runs of zeros.
+    std::mt19937_64 rng(12345);
+    for (bitwidth_t width : {100u, 5000u, 20000u}) {
+        SVInt value(width, 0, false);
+        for (bitwidth_t i = 0; i < width; i += 64)
+            value = value.shl(64) | SVInt(width, rng(), false);
+
+        auto str = value.toString(LiteralBase::Decimal, true, SVInt::MAX_BITS);
+        CHECK(SVInt::fromString(str) == value);
+
+        auto power = SVInt(width, 10, false).pow(SVInt(width, width / 8, false));
+        auto padded = (power + SVInt(width, 7, false)).toString(LiteralBase::Decimal, false,
+                                                               SVInt::MAX_BITS);
+        CHECK(padded.size() == width / 8 + 1);
+        CHECK(padded.substr(padded.size() - 2) == "07");
+    }
+}
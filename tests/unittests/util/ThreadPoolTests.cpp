@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "Test.h"
+#include <catch2/benchmark/catch_benchmark.hpp>
 
 #include "slang/util/ThreadPool.h"
 
@@ -263,6 +264,224 @@ TEST_CASE("ThreadPool -- pushLoop") {
     CHECK(std::ranges::all_of(flags10, [](auto&& f) -> bool { return f; }));
 }
 
+TEST_CASE("ThreadPool -- work stealing") {
+    ThreadPool pool(2);
+
+    // Block one worker; tasks that get queued up behind it should
+    // still be run by the other worker stealing them.
+    std::atomic<bool> release = false;
+    pool.pushTask([&release] {
+        while (!release)
+            std::this_thread::yield();
+    });
+
+    std::atomic<size_t> finished = 0;
+    for (size_t i = 0; i < 16; i++)
+        pool.pushTask([&finished] { finished++; });
+
+    while (finished < 16)
+        std::this_thread::yield();
+
+    release = true;
+    pool.waitForAll();
+    CHECK(finished == 16);
+}
+
+TEST_CASE("orderByCost") {
+    struct File {
+        std::string name;
+        uint64_t size;
+    };
+    std::vector<File> files = {{"a.sv", 10},  {"b.sv", 500}, {"c.sv", 10},
+                               {"d.sv", 2000}, {"e.sv", 500}, {"f.sv", 10}};
+    auto getSize = [](const File& file) { return file.size; };
+
+    // Larger files come first, and files of the same size keep their order.
+    auto order = orderByCost(std::span(files), getSize);
+    CHECK(order == std::vector<size_t>{3, 1, 4, 0, 2, 5});
+    CHECK(orderByCost(std::span(files), getSize) == order);
+    CHECK(orderByCost(std::span<File>(), getSize).empty());
+
+    // Tasks pushed in that order to a single thread run largest first.
+    ThreadPool pool(1);
+    std::vector<std::string> ran;
+    for (auto index : order)
+        pool.pushTask([&, index] { ran.push_back(files[index].name); });
+    pool.waitForAll();
+    CHECK(ran == std::vector<std::string>{"d.sv", "b.sv", "e.sv", "a.sv", "c.sv", "f.sv"});
+}
+
+TEST_CASE("ThreadPool -- nested pushTask") {
+    ThreadPool pool(2);
+    std::atomic<int> count = 0;
+    for (int i = 0; i < 8; i++) {
+        pool.pushTask([&] {
+            for (int j = 0; j < 8; j++)
+                pool.pushTask([&] { count++; });
+        });
+    }
+
+    pool.waitForAll();
+    CHECK(count == 64);
+}
+
+static void spinFor(std::chrono::microseconds duration) {
+    auto end = std::chrono::steady_clock::now() + duration;
+    while (std::chrono::steady_clock::now() < end) {
+    }
+}
+
+// A copy of the scheduler that ThreadPool used before it had per-worker
+// queues: every worker pulls from one mutex protected deque, and loops are
+// split into one block per thread by default. It's only kept around so that
+// the benchmarks below can compare against it.
+class SingleQueuePool {
+public:
+    explicit SingleQueuePool(size_t threadCount) {
+        for (size_t i = 0; i < threadCount; i++)
+            threads.emplace_back(&SingleQueuePool::worker, this);
+    }
+
+    ~SingleQueuePool() {
+        waitForAll();
+        {
+            std::unique_lock lock(mutex);
+            running = false;
+        }
+
+        taskAvailable.notify_all();
+        for (auto& thread : threads)
+            thread.join();
+    }
+
+    void pushTask(std::function<void()> task) {
+        {
+            std::unique_lock lock(mutex);
+            tasks.emplace_back(std::move(task));
+        }
+        taskAvailable.notify_one();
+    }
+
+    template<typename TFunc>
+    void pushLoop(size_t from, size_t to, TFunc&& body, size_t numBlocks = 0) {
+        if (!numBlocks)
+            numBlocks = threads.size();
+
+        const size_t totalSize = to - from;
+        size_t blockSize = totalSize / numBlocks;
+        if (blockSize == 0) {
+            blockSize = 1;
+            numBlocks = totalSize;
+        }
+
+        for (size_t i = 0; i < numBlocks; i++) {
+            const size_t start = i * blockSize + from;
+            const size_t end = i == numBlocks - 1 ? to : start + blockSize;
+            pushTask([&body, start, end] { body(start, end); });
+        }
+    }
+
+    void waitForAll() {
+        std::unique_lock lock(mutex);
+        taskDone.wait(lock, [this] { return !currentTasks && tasks.empty(); });
+    }
+
+private:
+    void worker() {
+        while (true) {
+            std::unique_lock lock(mutex);
+            taskAvailable.wait(lock, [this] { return !tasks.empty() || !running; });
+            if (!running)
+                break;
+
+            auto task = std::move(tasks.front());
+            tasks.pop_front();
+            ++currentTasks;
+            lock.unlock();
+            task();
+            lock.lock();
+            --currentTasks;
+
+            if (!currentTasks && tasks.empty())
+                taskDone.notify_all();
+        }
+    }
+
+    std::mutex mutex;
+    std::deque<std::function<void()>> tasks;
+    std::condition_variable taskAvailable;
+    std::condition_variable taskDone;
+    std::vector<std::thread> threads;
+    size_t currentTasks = 0;
+    bool running = true;
+};
+
+TEST_CASE("ThreadPool -- skewed workload benchmark", "[.][benchmark]") {
+    // Compares the old single queue scheduler against the work stealing one.
+    // The workload has a few huge items near the front followed by many small
+    // ones, so splitting it into one block per thread (the old default) leaves
+    // most threads idle while one works through the expensive items.
+    ThreadPool pool;
+    SingleQueuePool baseline(pool.getThreadCount());
+    const size_t numItems = 1024;
+    const size_t fineBlocks = pool.getThreadCount() * 8;
+    auto body = [](size_t start, size_t end) {
+        for (size_t i = start; i < end; i++)
+            spinFor(std::chrono::microseconds(i < 4 ? 20000 : 100));
+    };
+
+    BENCHMARK("single queue, one block per thread") {
+        baseline.pushLoop(size_t(0), numItems, body);
+        baseline.waitForAll();
+    };
+
+    BENCHMARK("single queue, fine-grained blocks") {
+        baseline.pushLoop(size_t(0), numItems, body, fineBlocks);
+        baseline.waitForAll();
+    };
+
+    BENCHMARK("work stealing, one block per thread") {
+        pool.pushLoop(size_t(0), numItems, body, pool.getThreadCount());
+        pool.waitForAll();
+    };
+
+    BENCHMARK("work stealing, default blocks") {
+        pool.pushLoop(size_t(0), numItems, body);
+        pool.waitForAll();
+    };
+}
+
+TEST_CASE("ThreadPool -- nested task benchmark", "[.][benchmark]") {
+    // Tasks of very different sizes that each push more tiny tasks, which is
+    // where contention on a single shared queue shows up the most.
+    ThreadPool pool;
+    SingleQueuePool baseline(pool.getThreadCount());
+    const int numOuter = 64;
+    const int numInner = 256;
+    std::atomic<int> count = 0;
+
+    auto run = [&](auto& target) {
+        count = 0;
+        for (int i = 0; i < numOuter; i++) {
+            target.pushTask([&target, &count, i] {
+                spinFor(std::chrono::microseconds(i % 8 == 0 ? 2000 : 10));
+                for (int j = 0; j < numInner; j++)
+                    target.pushTask([&count] { count++; });
+            });
+        }
+        target.waitForAll();
+        return count.load();
+    };
+
+    BENCHMARK("single queue") {
+        return run(baseline);
+    };
+
+    BENCHMARK("work stealing") {
+        return run(pool);
+    };
+}
+
 #ifdef CI_BUILD
 
 TEST_CASE("ThreadPool -- no destruction deadlocks") {
@@ -3,8 +3,12 @@
 
 #include "Test.h"
 #include <catch2/matchers/catch_matchers_string.hpp>
+#include <regex>
 #include <sstream>
+#include <thread>
 
+#include "slang/ast/Compilation.h"
+#include "slang/util/BumpAllocator.h"
 #include "slang/util/Random.h"
 #include "slang/util/ThreadPool.h"
 #include "slang/util/TimeTrace.h"
@@ -61,6 +65,204 @@ TEST_CASE("TimeTrace tests") {
 
     pool.waitForAll();
 
+    // Sections measured by the caller are written as complete events
+    // attributed to the given thread.
+    auto start = std::chrono::steady_clock::now();
+    std::thread([start] {
+        TimeTrace::addSection("parse worker busy"sv, "3 tasks"sv, std::this_thread::get_id(),
+                              start, std::chrono::microseconds(1500));
+    }).join();
+
     std::ostringstream sstr;
     TimeTrace::write(sstr);
+
+    // The main thread is written as tid 0, so the worker gets a different one.
+    std::regex sectionRegex(R"(\{ "pid":1, "tid":[1-9][0-9]*, "ph":"X", "ts":[0-9]+, "dur":1500, )"
+                            R"("name":"parse worker busy", "args":\{ "detail":"3 tasks" \} \})");
+    CHECK(std::regex_search(sstr.str(), sectionRegex));
+}
+
+TEST_CASE("BumpAllocator growth and stats") {
+    BumpAllocatorOptions options;
+    options.segmentSize = 1024;
+    options.segmentsPerDoubling = 2;
+    options.maxSegmentSize = 8192;
+
+    BumpAllocator alloc(options);
+    auto stats = alloc.getStats();
+    CHECK(stats.bytesUsed == 0);
+    CHECK(stats.segmentCount == 1);
+
+    size_t total = 0;
+    for (int i = 0; i < 1000; i++) {
+        auto ptr = alloc.allocate(96, 8);
+        CHECK(reinterpret_cast<uintptr_t>(ptr) % 8 == 0);
+        memset(ptr, i, 96);
+        total += 96;
+    }
+
+    // With growth capped at 8k we need far fewer segments than the
+    // 100+ that fixed 1k segments would have required.
+    stats = alloc.getStats();
+    CHECK(stats.bytesUsed == total);
+    CHECK(stats.bytesReserved >= total);
+    CHECK(stats.segmentCount > 1);
+    CHECK(stats.segmentCount < 30);
+    CHECK(stats.wastedBytes() < stats.bytesReserved / 4);
+
+    // Large allocations get their own segment.
+    alloc.allocate(100000, 16);
+    auto largeStats = alloc.getStats();
+    CHECK(largeStats.segmentCount == stats.segmentCount + 1);
+    CHECK(largeStats.bytesReserved >= stats.bytesReserved + 100000);
+    CHECK(largeStats.bytesUsed == stats.bytesUsed + 100000);
+
+    BumpAllocator other;
+    other.allocate(64, 8);
+    auto otherStats = other.getStats();
+
+    alloc.steal(std::move(other));
+    stats = alloc.getStats();
+    CHECK(stats.bytesUsed == largeStats.bytesUsed + otherStats.bytesUsed);
+    CHECK(stats.segmentCount == largeStats.segmentCount + otherStats.segmentCount);
+
+    BumpAllocator moved(std::move(alloc));
+    CHECK(moved.getStats().bytesUsed == stats.bytesUsed);
+    CHECK(alloc.getStats().segmentCount == 0);
+
+    BumpAllocatorStats sum;
+    sum += stats;
+    sum += otherStats;
+    CHECK(sum.segmentCount == stats.segmentCount + otherStats.segmentCount);
+}
+
+TEST_CASE("BumpAllocator stats after move") {
+    auto checkEmpty = [](const BumpAllocator& alloc) {
+        auto stats = alloc.getStats();
+        CHECK(stats.bytesUsed == 0);
+        CHECK(stats.bytesReserved == 0);
+        CHECK(stats.segmentCount == 0);
+        CHECK(stats.wastedBytes() == 0);
+    };
+
+    BumpAllocator alloc;
+    alloc.allocate(128, 8);
+    auto stats = alloc.getStats();
+
+    BumpAllocator moved(std::move(alloc));
+    CHECK(moved.getStats().bytesUsed == stats.bytesUsed);
+    checkEmpty(alloc);
+
+    BumpAllocator assigned;
+    assigned.allocate(16, 8);
+    assigned = std::move(moved);
+    CHECK(assigned.getStats().bytesUsed == stats.bytesUsed);
+    CHECK(assigned.getStats().wastedBytes() == stats.wastedBytes());
+    checkEmpty(moved);
+
+    BumpAllocator target;
+    target.steal(std::move(assigned));
+    CHECK(target.getStats().bytesUsed == stats.bytesUsed);
+    checkEmpty(assigned);
+}
+
+TEST_CASE("BumpAllocator options from option bag") {
+    BumpAllocatorOptions options;
+    options.segmentSize = 8192;
+    options.segmentsPerDoubling = 0;
+
+    Bag bag;
+    bag.set(options);
+
+    Compilation compilation(bag);
+    CHECK(compilation.BumpAllocator::getOptions().segmentSize == 8192);
+    CHECK(compilation.getThreadAllocator().getOptions().segmentSize == 8192);
+
+    std::thread thread([&] {
+        CHECK(compilation.getThreadAllocator().getOptions().segmentsPerDoubling == 0);
+    });
+    thread.join();
+
+    Compilation defaults;
+    CHECK(defaults.BumpAllocator::getOptions().segmentSize == BumpAllocatorOptions{}.segmentSize);
+}
+
+TEST_CASE("Compilation allocation from multiple threads") {
+    Compilation compilation;
+
+    constexpr uint32_t NumTasks = 16;
+    constexpr uint32_t NumIters = 2000;
+    struct Results {
+        BumpAllocator* alloc = nullptr;
+        std::vector<uint32_t*> ints;
+        std::vector<std::span<char>> strings;
+        std::vector<std::span<uint32_t>> copies;
+    };
+
+    auto allocAll = [&](Results& results, uint32_t base) {
+        auto& alloc = compilation.getThreadAllocator();
+        results.alloc = &alloc;
+        for (uint32_t i = 0; i < NumIters; i++) {
+            auto val = base + i;
+            results.ints.push_back(alloc.emplace<uint32_t>(val));
+
+            auto str = std::to_string(val);
+            results.strings.push_back(alloc.copyFrom(std::span<const char>(str)));
+
+            SmallVector<uint32_t> vec;
+            vec.push_back(val);
+            results.copies.push_back(vec.copy(alloc));
+        }
+    };
+
+    // Allocate from the owning thread at the same time as the workers.
+    std::vector<Results> results(NumTasks + 1);
+    ThreadPool pool(8);
+    for (uint32_t t = 0; t < NumTasks; t++)
+        pool.pushTask([&, t] { allocAll(results[t], t * NumIters); });
+
+    allocAll(results[NumTasks], NumTasks * NumIters);
+    pool.waitForAll();
+
+    // The owning thread allocates from the compilation itself.
+    CHECK(results[NumTasks].alloc == &compilation);
+
+    for (uint32_t t = 0; t <= NumTasks; t++) {
+        auto& r = results[t];
+        if (t < NumTasks)
+            CHECK(r.alloc != &compilation);
+
+        REQUIRE(r.ints.size() == NumIters);
+        for (uint32_t i = 0; i < NumIters; i++) {
+            auto val = t * NumIters + i;
+            auto str = std::to_string(val);
+            CHECK(*r.ints[i] == val);
+            CHECK(std::string_view(r.strings[i].data(), r.strings[i].size()) == str);
+            CHECK(r.copies[i].size() == 1);
+            CHECK(r.copies[i][0] == val);
+        }
+    }
+
+    auto stats = compilation.getAllocatorStats();
+    CHECK(stats.bytesUsed >= (NumTasks + 1) * NumIters * sizeof(uint32_t));
+}
+
+TEST_CASE("BumpAllocator huge pages") {
+    BumpAllocatorOptions options;
+    options.segmentSize = 2 * 1024 * 1024;
+    options.maxSegmentSize = options.segmentSize;
+    options.useHugePages = true;
+
+    // Huge pages may not be available on the system; allocation should
+    // work either way.
+    BumpAllocator alloc(options);
+    for (int i = 0; i < 4; i++) {
+        auto ptr = alloc.allocate(600 * 1024, 64);
+        memset(ptr, 0xab, 600 * 1024);
+    }
+
+    auto stats = alloc.getStats();
+    CHECK(stats.bytesUsed >= 4 * 600 * 1024);
+    CHECK(stats.bytesUsed < 4 * 600 * 1024 + 4 * 64);
+    CHECK(stats.segmentCount == 3);
 }
@@ -163,6 +163,23 @@ int driverMain(int argc, TArgs argv) {
                     ok &= driver.reportCompilation(*compilation, quiet == true);
                     if (astJsonFile)
                         printJson(*compilation, *astJsonFile, astJsonScopes);
+
+                    if (TimeTrace::isEnabled()) {
+                        auto stats = compilation->getConstantMemoStats();
+                        TimeTrace::addCounter("constexprMemo"sv, {{"hits"sv, stats.hits},
+                                                                   {"misses"sv, stats.misses},
+                                                                   {"entries"sv, stats.entries}});
+
+                        auto memStats = compilation->getAllocatorStats();
+                        for (auto& tree : driver.syntaxTrees)
+                            memStats += tree->getAllocatorStats();
+
+                        TimeTrace::addCounter("memory"sv,
+                                              {{"used"sv, memStats.bytesUsed},
+                                               {"reserved"sv, memStats.bytesReserved},
+                                               {"segments"sv, memStats.segmentCount},
+                                               {"wasted"sv, memStats.wastedBytes()}});
+                    }
                 }
             }
         }
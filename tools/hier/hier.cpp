@@ -11,9 +11,154 @@ using namespace slang;
 using namespace slang::driver;
 using namespace slang::ast;
 
+// Walks the instance tree and prints each module instance. The hierarchical
+// path of the current scope is built up as we descend instead of being
+// recomputed from the root for every instance, and output is collected in
+// a buffer that is written out in large chunks.
+struct HierarchyPrinter : public ASTVisitor<HierarchyPrinter, false, false> {
+    static constexpr size_t BufferSize = 1 << 16;
+
+    const SourceManager& sourceManager;
+    bool params = false;
+    int depth = -1; // will never be 0, go full depth
+    std::optional<std::string> instPrefix;
+    std::optional<std::regex> instRegex;
+    std::optional<std::string> customFormat;
+
+    std::string path;
+    int index = 0;
+    fmt::memory_buffer buffer;
+
+    explicit HierarchyPrinter(const SourceManager& sourceManager) : sourceManager(sourceManager) {}
+
+    void handle(const InstanceSymbol& type) {
+        if (!type.isModule())
+            return;
+
+        int pathLength = instPrefix.value_or("").length();
+        int len = type.name.length();
+        int save_index = index;
+        // if no instPrefix, pathLength is 0, and this check will never take place, so
+        // instPrefix.value() is safe if index >= pathLength we satisfied the full
+        // instPrefix. from now on we are limited only by max-depth
+        if (index < pathLength) {
+            if (type.name != instPrefix.value().substr(index, std::min(pathLength - index, len))) {
+                // current instance name did not match
+                return;
+            }
+            index += len;
+            if (index < pathLength && instPrefix.value()[index] != '.') {
+                index = save_index;
+                return; // separator needed, but didn't find one
+            }
+            index++;    // adjust for '.'
+        }
+
+        auto savedLength = path.size();
+        appendName(type.name);
+        if (!type.arrayPath.empty()) {
+            SmallVector<ConstantRange, 8> instanceDims;
+            type.getArrayDimensions(instanceDims);
+            SLANG_ASSERT(instanceDims.size() == type.arrayPath.size());
+
+            for (size_t i = 0; i < instanceDims.size(); i++) {
+                auto dim = instanceDims[i];
+                auto idx = dim.translateIndex(type.arrayPath[i]) + dim.lower();
+                fmt::format_to(std::back_inserter(path), "[{}]", idx);
+            }
+        }
+
+        if (!instRegex || std::regex_search(path, *instRegex))
+            print(type);
+
+        depth--;
+        if (depth)
+            visitDefault(type.body);
+        depth++;
+        index = save_index;
+        path.resize(savedLength);
+    }
+
+    void handle(const InstanceArraySymbol& symbol) { visitScope(symbol, symbol.name); }
+    void handle(const GenerateBlockArraySymbol& symbol) { visitScope(symbol, symbol.name); }
+
+    void handle(const GenerateBlockSymbol& symbol) {
+        auto savedLength = path.size();
+        appendName(symbol.name);
+        if (symbol.arrayIndex) {
+            path.push_back('[');
+            path.append(symbol.arrayIndex->toString(LiteralBase::Decimal, false));
+            path.push_back(']');
+        }
+        else if (symbol.name.empty()) {
+            appendName(symbol.getExternalName());
+        }
+
+        visitDefault(symbol);
+        path.resize(savedLength);
+    }
+
+    template<typename T>
+    void handle(const T&) {}
+
+    void flush() {
+        OS::print(std::string_view(buffer.data(), buffer.size()));
+        buffer.clear();
+    }
+
+private:
+    void appendName(std::string_view name) {
+        if (name.empty())
+            return;
+
+        if (!path.empty())
+            path.push_back('.');
+        path.append(name);
+    }
+
+    template<typename T>
+    void visitScope(const T& symbol, std::string_view name) {
+        auto savedLength = path.size();
+        appendName(name);
+        visitDefault(symbol);
+        path.resize(savedLength);
+    }
+
+    void print(const InstanceSymbol& type) {
+        auto out = fmt::appender(buffer);
+        auto s_module = type.getDefinition().name;
+        auto s_file = sourceManager.getFileName(type.getDefinition().location);
+        if (customFormat.has_value())
+            fmt::format_to(out, fmt::runtime(customFormat.value()), fmt::arg("module", s_module),
+                           fmt::arg("inst", path), fmt::arg("file", s_file));
+        else
+            fmt::format_to(out, "Module=\"{}\" Instance=\"{}\" File=\"{}\" ", s_module, path,
+                           s_file);
+
+        auto parameters = type.body.getParameters();
+        size_t size = parameters.size();
+        if (size && params) {
+            fmt::format_to(out, "Parameters: ");
+            for (auto p : parameters) {
+                size--;
+                std::string v;
+                if (p->symbol.kind == SymbolKind::Parameter)
+                    v = p->symbol.as<ParameterSymbol>().getValue().toString();
+                else if (p->symbol.kind == SymbolKind::TypeParameter)
+                    v = p->symbol.as<TypeParameterSymbol>().targetType.getType().toString();
+                else
+                    v = "?";
+                fmt::format_to(out, "{}={}{}", p->symbol.name, v, size ? ", " : "");
+            }
+        }
+        buffer.push_back('\n');
+
+        if (buffer.size() >= BufferSize)
+            flush();
+    }
+};
+
 int main(int argc, char** argv) {
-    std::regex regex;
-    std::smatch match;
     Driver driver;
     driver.addStandardArgs();
 
@@ -55,75 +200,26 @@ int main(int argc, char** argv) {
     if (!driver.processOptions())
         return 2;
 
+    // Only the instance tree and parameter values are printed, so there's
+    // no need to bind the contents of every instance body.
+    driver.options.compilationFlags[CompilationFlags::HierarchyOnly] = true;
+
     bool ok = driver.parseAllSources();
 
     auto compilation = driver.createCompilation();
-    auto sourceManager = compilation->getSourceManager();
 
+    HierarchyPrinter printer(*compilation->getSourceManager());
+    printer.params = params.value_or(false);
+    printer.depth = maxDepth.value_or(-1);
+    printer.instPrefix = instPrefix;
+    printer.customFormat = customFormat;
     if (instRegex.has_value())
-        regex = instRegex.value();
-    auto instances = compilation->getRoot().topInstances;
-    for (auto& i : instances) {
-        int depth = maxDepth.value_or(-1); // will never be 0, go full depth
-        int pathLength = instPrefix.value_or("").length();
-        int index = 0;
-        i->visit(makeVisitor([&](auto& visitor, const InstanceSymbol& type) {
-            if (type.isModule()) {
-                std::string s_inst;
-                int len = type.name.length();
-                int save_index = index;
-                // if no instPrefix, pathLength is 0, and this check will never take place, so
-                // instPrefix.value() is safe if index >= pathLength we satisfied the full
-                // instPrefix. from now on we are limited only by max-depth
-                if (index < pathLength) {
-                    if (type.name !=
-                        instPrefix.value().substr(index, std::min(pathLength - index, len))) {
-                        // current instance name did not match
-                        return;
-                    }
-                    index += len;
-                    if (index < pathLength && instPrefix.value()[index] != '.')
-                        return; // separator needed, but didn't find one
-                    index++;    // adjust for '.'
-                }
-                type.getHierarchicalPath(s_inst);
-                if (!instRegex.has_value() || std::regex_search(s_inst, match, regex)) {
-                    auto s_module = type.getDefinition().name;
-                    auto s_file = sourceManager->getFileName(type.getDefinition().location);
-                    if (customFormat.has_value())
-                        OS::print(fmt::format(fmt::runtime(customFormat.value()),
-                                              fmt::arg("module", s_module),
-                                              fmt::arg("inst", s_inst), fmt::arg("file", s_file)));
-                    else
-                        OS::print(fmt::format("Module=\"{}\" Instance=\"{}\" File=\"{}\" ",
-                                              s_module, s_inst, s_file));
-                    int size = type.body.getParameters().size();
-                    if (size && params.value_or(false)) {
-                        OS::print(fmt::format("Parameters: "));
-                        for (auto p : type.body.getParameters()) {
-                            std::string v;
-                            size--;
-                            if (p->symbol.kind == SymbolKind::Parameter)
-                                v = p->symbol.as<ParameterSymbol>().getValue().toString();
-                            else if (p->symbol.kind == SymbolKind::TypeParameter)
-                                v = p->symbol.as<TypeParameterSymbol>()
-                                        .targetType.getType()
-                                        .toString();
-                            else
-                                v = "?";
-                            OS::print(fmt::format("{}={}{}", p->symbol.name, v, size ? ", " : ""));
-                        }
-                    }
-                    OS::print("\n");
-                }
-                depth--;
-                if (depth)
-                    visitor.visitDefault(type);
-                depth++;
-                index = save_index;
-            }
-        }));
-    }
+        printer.instRegex.emplace(*instRegex);
+
+    for (auto inst : compilation->getRoot().topInstances)
+        printer.visit(*inst);
+    printer.flush();
+
     ok &= driver.reportCompilation(*compilation, /* quiet */ false);
 
     return ok ? 0 : 3;
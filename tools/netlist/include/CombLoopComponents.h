@@ -0,0 +1,78 @@
+//------------------------------------------------------------------------------
+//! @file CombLoopComponents.h
+//! @brief Combinatorial loop detection via strongly connected components
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "CombLoops.h"
+#include "Netlist.h"
+#include <cstdint>
+#include <vector>
+
+namespace netlist {
+
+/// A strongly connected component of the combinatorial part of a netlist.
+/// Every such component with more than one node (or with a node that feeds
+/// itself) contains at least one combinatorial loop.
+struct LoopComponent {
+    /// The indices of the netlist nodes in the component, in ascending order.
+    std::vector<ID_type> nodes;
+
+    /// Elementary cycles found within the component, each given as the list
+    /// of node indices along it, starting from its lowest numbered node.
+    std::vector<CycleListType> cycles;
+
+    /// Set if cycle enumeration stopped because the component contains more
+    /// cycles than the limit allowed to be reported.
+    bool limitReached = false;
+};
+
+/// Options that control the loop component search.
+struct LoopComponentOptions {
+    /// The maximum number of cycles to enumerate per component, or zero to
+    /// enumerate all of them. The default reports one representative cycle.
+    size_t maxCyclesPerComponent = 1;
+
+    /// The number of threads used to enumerate cycles in independent components.
+    /// Zero uses the hardware concurrency; one does all work on the calling thread.
+    unsigned numThreads = 0;
+};
+
+/// Finds combinatorial loops in a netlist without enumerating every elementary
+/// cycle up front, which is exponential in the worst case.
+///
+/// The search runs on the frozen form of the netlist (see Netlist::freeze), which
+/// already excludes disabled edges, and follows only combinatorial edges, i.e.
+/// those that don't start or end at a node assigned on a clock edge. That part
+/// of the graph is first partitioned into strongly connected components using
+/// an iterative form of Tarjan's algorithm, so there's no limit on the depth of
+/// the graph. Each component that contains a loop is then searched for a
+/// bounded number of elementary cycles with Johnson's algorithm, restricted to
+/// the nodes of that component. Components are independent, so they are
+/// searched in parallel.
+class LoopComponentSearch {
+public:
+    using node_id = FrozenNetlist::node_id;
+
+    /// Prepares a search over @a graph, which must outlive the search object.
+    explicit LoopComponentSearch(const FrozenNetlist& graph);
+
+    /// Find all components that contain loops, ordered by their lowest node index.
+    std::vector<LoopComponent> find(const LoopComponentOptions& options = {}) const;
+
+private:
+    std::vector<std::vector<node_id>> findComponents() const;
+    void findCycles(LoopComponent& component, const std::vector<node_id>& nodes,
+                    size_t maxCycles) const;
+
+    const FrozenNetlist& graph;
+
+    // Whether each node of the graph can be part of a combinatorial path;
+    // an edge is combinatorial if both of its ends are.
+    std::vector<bool> combinatorial;
+};
+
+} // namespace netlist
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+//! @file CompactGraph.h
+//! @brief Read-only compressed sparse row form of a directed graph
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "DirectedGraph.h"
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include "slang/util/Hash.h"
+#include "slang/util/Util.h"
+
+namespace netlist {
+
+/// Selects every edge of a graph.
+struct select_all {
+    template<typename T>
+    bool operator()(const T&) const {
+        return true;
+    }
+};
+
+/// An immutable snapshot of a DirectedGraph in compressed sparse row (CSR) form.
+///
+/// Nodes are identified by dense integer IDs in the order they appear in the
+/// source graph, and the targets of all edges are stored contiguously, so
+/// traversals only touch a couple of flat arrays instead of chasing pointers
+/// through per-node edge lists. Algorithms running on the compact graph can
+/// use plain vectors indexed by node ID (bitsets for visited sets, parent arrays
+/// for search trees) in place of node keyed sets and maps.
+///
+/// The snapshot refers to the nodes of the source graph, so it must not outlive
+/// it, and any changes made to the source graph afterwards are not reflected.
+template<class NodeType, class EdgeType>
+class CompactGraph {
+public:
+    using node_id = uint32_t;
+    static constexpr node_id null_node = std::numeric_limits<node_id>::max();
+
+    /// Builds the compact form of @a graph, including only the edges selected
+    /// by @a edgePredicate. The edges of each node keep their original order.
+    template<class EdgePredicate = select_all>
+    explicit CompactGraph(const DirectedGraph<NodeType, EdgeType>& graph,
+                          EdgePredicate edgePredicate = {}) {
+        SLANG_ASSERT(graph.numNodes() < null_node);
+
+        nodes.reserve(graph.numNodes());
+        ids.reserve(graph.numNodes());
+        for (auto& node : graph) {
+            ids.emplace(node.get(), node_id(nodes.size()));
+            nodes.push_back(node.get());
+        }
+
+        offsets.reserve(nodes.size() + 1);
+        offsets.push_back(0);
+        for (auto* node : nodes) {
+            for (auto& edge : node->getEdges()) {
+                if (edgePredicate(*edge))
+                    targets.push_back(ids.at(&edge->getTargetNode()));
+            }
+            offsets.push_back(targets.size());
+        }
+    }
+
+    /// Return the number of nodes in the graph.
+    size_t numNodes() const { return nodes.size(); }
+
+    /// Return the number of edges in the graph.
+    size_t numEdges() const { return targets.size(); }
+
+    /// Return the node with the given ID.
+    NodeType& getNode(node_id id) const {
+        SLANG_ASSERT(id < nodes.size());
+        return *nodes[id];
+    }
+
+    /// Return the ID of the given node, or null_node if it isn't in the graph.
+    node_id getId(const NodeType& node) const {
+        auto it = ids.find(&node);
+        return it != ids.end() ? it->second : null_node;
+    }
+
+    /// Return the IDs of the targets of the edges outgoing from a node.
+    std::span<const node_id> successors(node_id id) const {
+        SLANG_ASSERT(id < nodes.size());
+        return std::span(targets).subspan(offsets[id], offsets[id + 1] - offsets[id]);
+    }
+
+    /// Return the number of edges outgoing from a node.
+    size_t outDegree(node_id id) const {
+        SLANG_ASSERT(id < nodes.size());
+        return offsets[id + 1] - offsets[id];
+    }
+
+private:
+    std::vector<NodeType*> nodes;
+    slang::flat_hash_map<const NodeType*, node_id> ids;
+
+    // The edges outgoing from node i are targets[offsets[i]] .. targets[offsets[i + 1] - 1].
+    std::vector<size_t> offsets;
+    std::vector<node_id> targets;
+};
+
+} // namespace netlist
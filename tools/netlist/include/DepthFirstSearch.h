@@ -7,19 +7,14 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include "CompactGraph.h"
 #include "DirectedGraph.h"
 #include <set>
+#include <utility>
 #include <vector>
 
 namespace netlist {
 
-struct select_all {
-    template<typename T>
-    bool operator()(const T&) const {
-        return true;
-    }
-};
-
 /// Depth-first search on a directed graph. A visitor class provides visibility
 /// to the caller of visits to edges and nodes. An optional edge predicate
 /// selects which edges can be included in the traversal.
@@ -79,4 +74,57 @@ private:
     std::vector<VisitStackElement> visitStack;
 };
 
+/// Depth-first search on a CompactGraph. Nodes are tracked by ID, with a bitset
+/// for the visited set, and the traversal is iterative so that it isn't limited
+/// by the depth of the graph. Edges are followed in the same order as
+/// DepthFirstSearch would on the source graph. The visitor is called with node
+/// IDs: visitEdge(source, target) for each tree edge, and visitNode(node) for
+/// each newly reached node, which returns false to end the search early.
+template<class GraphType, class Visitor>
+class CompactDepthFirstSearch {
+public:
+    using node_id = typename GraphType::node_id;
+
+    CompactDepthFirstSearch(Visitor& visitor, const GraphType& graph, node_id startNode) :
+        visitor(visitor), graph(graph), visitedNodes(graph.numNodes()) {
+        run(startNode);
+    }
+
+    /// Return true if the given node was reached by the search.
+    bool isVisited(node_id node) const { return visitedNodes[node]; }
+
+private:
+    void run(node_id startNode) {
+        visitedNodes[startNode] = true;
+        if (!visitor.visitNode(startNode))
+            return;
+
+        visitStack.emplace_back(startNode, 0);
+        while (!visitStack.empty()) {
+            auto [node, index] = visitStack.back();
+            auto successors = graph.successors(node);
+            if (index == successors.size()) {
+                // All children of this node have been visited, so remove it from the stack.
+                visitStack.pop_back();
+                continue;
+            }
+
+            visitStack.back().second++;
+            auto targetNode = successors[index];
+            if (!visitedNodes[targetNode]) {
+                visitedNodes[targetNode] = true;
+                visitor.visitEdge(node, targetNode);
+                if (!visitor.visitNode(targetNode))
+                    return;
+                visitStack.emplace_back(targetNode, 0);
+            }
+        }
+    }
+
+    Visitor& visitor;
+    const GraphType& graph;
+    std::vector<bool> visitedNodes;
+    std::vector<std::pair<node_id, size_t>> visitStack;
+};
+
 } // namespace netlist
@@ -13,6 +13,7 @@
 #include <memory>
 #include <vector>
 
+#include "slang/util/Hash.h"
 #include "slang/util/Util.h"
 
 namespace netlist {
@@ -76,10 +77,12 @@ public:
 
     Node<NodeType, EdgeType>& operator=(const Node<NodeType, EdgeType>& node) {
         edges = node.edges;
+        edgeIndex = node.edgeIndex;
         return *this;
     }
     Node<NodeType, EdgeType>& operator=(Node<NodeType, EdgeType>&& node) noexcept {
         edges = std::move(node.Edges);
+        edgeIndex = std::move(node.edgeIndex);
         return *this;
     }
 
@@ -91,25 +94,34 @@ public:
     }
     bool operator==(const NodeType& N) const { return getDerived().isEqualTo(N); }
 
+    /// Return a pointer to the edge connecting the target node, or nullptr if
+    /// there is no such edge. This is a constant time lookup.
+    EdgeType* getEdgeTo(const NodeType& targetNode) const {
+        auto it = edgeIndex.find(&targetNode);
+        return it != edgeIndex.end() ? it->second : nullptr;
+    }
+
     /// Return an iterator to the edge connecting the target node.
     const_iterator findEdgeTo(const NodeType& targetNode) {
-        return std::ranges::find_if(edges, [&targetNode](std::unique_ptr<EdgeType>& edge) {
-            return edge->getTargetNode() == targetNode;
+        auto* edge = getEdgeTo(targetNode);
+        if (!edge)
+            return edges.end();
+
+        return std::ranges::find_if(edges, [edge](std::unique_ptr<EdgeType>& candidate) {
+            return candidate.get() == edge;
         });
     }
 
     /// Add an edge between this node and a target node, only if it does not
     /// already exist. Return a pointer to the newly-created edge.
     EdgeType& addEdge(NodeType& targetNode) {
-        auto edgeIt = findEdgeTo(targetNode);
-        if (edgeIt == edges.end()) {
+        auto [it, inserted] = edgeIndex.try_emplace(&targetNode, nullptr);
+        if (inserted) {
             auto edge = std::make_unique<EdgeType>(getDerived(), targetNode);
+            it->second = edge.get();
             edges.emplace_back(std::move(edge));
-            return *(edges.back().get());
-        }
-        else {
-            return *((*edgeIt).get());
         }
+        return *it->second;
     }
 
     /// Remove an edge between this node and a target node.
@@ -117,6 +129,7 @@ public:
     bool removeEdge(NodeType& targetNode) {
         auto edgeIt = findEdgeTo(targetNode);
         if (edgeIt != edges.end()) {
+            edgeIndex.erase(&targetNode);
             edges.erase(edgeIt);
             return true;
         }
@@ -129,11 +142,8 @@ public:
     /// node. Return true if at least one edge was found.
     bool getEdgesTo(const NodeType& targetNode, std::vector<EdgeType*>& result) {
         SLANG_ASSERT(result.empty() && "Expected the results parameter to be empty");
-        for (auto& edge : edges) {
-            if (edge->getTargetNode() == targetNode) {
-                result.push_back(edge.get());
-            }
-        }
+        if (auto* edge = getEdgeTo(targetNode))
+            result.push_back(edge);
         return !result.empty();
     }
 
@@ -144,7 +154,10 @@ public:
     size_t outDegree() const { return edges.size(); }
 
     /// Remove all edges outgoing from this node.
-    void clearEdges() { edges.clear(); }
+    void clearEdges() {
+        edges.clear();
+        edgeIndex.clear();
+    }
 
 protected:
     // As the default implementation use address comparison for equality.
@@ -154,6 +167,11 @@ protected:
     const NodeType& getDerived() const { return *static_cast<const NodeType*>(this); }
 
     EdgeListType edges;
+
+    // Index of outgoing edges by target node, used to deduplicate edges and
+    // to look them up in constant time. Since multi-edges are not permitted
+    // there is at most one edge per target.
+    slang::flat_hash_map<const NodeType*, EdgeType*> edgeIndex;
 };
 
 /// A directed graph.
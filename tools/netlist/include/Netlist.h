@@ -7,11 +7,14 @@
 //------------------------------------------------------------------------------
 #pragma once
 
+#include "CompactGraph.h"
 #include "Config.h"
 #include "Debug.h"
 #include "DirectedGraph.h"
 #include "fmt/color.h"
 #include "fmt/format.h"
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <utility>
 
@@ -99,7 +102,7 @@ struct VariableSelectorBase {
     template<typename T>
     const T& as() const {
         SLANG_ASSERT(T::isKind(kind));
-        return const_cast<T&>(this->as<T>());
+        return const_cast<VariableSelectorBase*>(this)->as<T>();
     }
 };
 
@@ -235,7 +238,7 @@ public:
     template<typename T>
     const T& as() const {
         SLANG_ASSERT(T::isKind(kind));
-        return const_cast<T&>(this->as<T>());
+        return const_cast<NetlistNode*>(this)->as<T>();
     }
 
     /// Return the out degree of this node, including only enabled edges.
@@ -258,8 +261,9 @@ public:
     ast::EdgeKind edgeKind;
     bool blocked{};
 
-private:
-    static size_t nextID;
+    /// The most recently allocated node ID. Nodes may be created concurrently
+    /// in netlist fragments, which are given IDs in order when they're merged.
+    static std::atomic<size_t> nextID;
 };
 
 /// A class representing a port declaration.
@@ -308,19 +312,6 @@ public:
         NetlistNode(NodeKind::VariableReference, symbol), expression(expr),
         leftOperand(leftOperand) {}
 
-    void addElementSelect(ast::ElementSelectExpression const& expr, const ConstantValue& index) {
-        selectors.emplace_back(std::make_unique<VariableElementSelect>(expr.selector(), index));
-    }
-
-    void addRangeSelect(ast::RangeSelectExpression const& expr, const ConstantValue& leftIndex,
-                        const ConstantValue& rightIndex) {
-        selectors.emplace_back(std::make_unique<VariableRangeSelect>(expr, leftIndex, rightIndex));
-    }
-
-    void addMemberAccess(std::string_view name) {
-        selectors.emplace_back(std::make_unique<VariableMemberAccess>(name));
-    }
-
     static bool isKind(NodeKind otherKind) { return otherKind == NodeKind::VariableReference; }
 
     bool isLeftOperand() const { return leftOperand; }
@@ -357,18 +348,31 @@ public:
     ConstantRange bounds;
 };
 
+/// A compact, read-only form of the netlist used for traversals.
+using FrozenNetlist = CompactGraph<NetlistNode, NetlistEdge>;
+
 /// A class representing the design netlist.
 class Netlist : public DirectedGraph<NetlistNode, NetlistEdge> {
 public:
     Netlist() : DirectedGraph() {}
 
+    /// Create a fragment that is used to build part of a netlist independently
+    /// of the rest of it, before being combined with mergeFragment(). Variables
+    /// that are declared outside of the fragment are represented by placeholder
+    /// nodes, which are resolved when the fragment is merged.
+    static Netlist createFragment() {
+        Netlist fragment;
+        fragment.isFragment = true;
+        return fragment;
+    }
+
     /// Add a port declaration node to the netlist.
     NetlistPortDeclaration& addPortDeclaration(const ast::Symbol& symbol) {
         auto nodePtr = std::make_unique<NetlistPortDeclaration>(symbol);
         auto& node = nodePtr->as<NetlistPortDeclaration>();
         symbol.getHierarchicalPath(node.hierarchicalPath);
-        SLANG_ASSERT(lookupPort(nodePtr->hierarchicalPath) == nullptr &&
-                     "Port declaration already exists");
+        [[maybe_unused]] auto inserted = portIndex.emplace(node.hierarchicalPath, &node).second;
+        SLANG_ASSERT(inserted && "Port declaration already exists");
         nodes.push_back(std::move(nodePtr));
         DEBUG_PRINT("New node: port declaration {}\n", node.hierarchicalPath);
         return node;
@@ -383,8 +387,9 @@ public:
         }
         else {
             auto nodePtr = std::make_unique<NetlistVariableDeclaration>(symbol);
-            nodePtr->hierarchicalPath = hierPath;
+            nodePtr->hierarchicalPath = std::move(hierPath);
             auto& node = nodePtr->as<NetlistVariableDeclaration>();
+            variableIndex.emplace(node.hierarchicalPath, &node);
             nodes.push_back(std::move(nodePtr));
             DEBUG_PRINT("Add var decl {}\n", node.hierarchicalPath);
             return node;
@@ -411,47 +416,204 @@ public:
         return node;
     }
 
-    // without this, the base class method will be hidden,
-    // even when calling netlist.addEdge with only 2 parameters
-    using DirectedGraph<NetlistNode, NetlistEdge>::addEdge;
+    /// Add an element select to a variable reference node in the netlist.
+    void addElementSelect(NetlistVariableReference& node,
+                          ast::ElementSelectExpression const& expr, const ConstantValue& index) {
+        node.selectors.emplace_back(
+            std::make_unique<VariableElementSelect>(expr.selector(), index));
+        selectorVersion++;
+    }
+
+    /// Add a range select to a variable reference node in the netlist.
+    void addRangeSelect(NetlistVariableReference& node, ast::RangeSelectExpression const& expr,
+                        const ConstantValue& leftIndex, const ConstantValue& rightIndex) {
+        node.selectors.emplace_back(
+            std::make_unique<VariableRangeSelect>(expr, leftIndex, rightIndex));
+        selectorVersion++;
+    }
+
+    /// Add a member access to a variable reference node in the netlist.
+    void addMemberAccess(NetlistVariableReference& node, std::string_view name) {
+        node.selectors.emplace_back(std::make_unique<VariableMemberAccess>(name));
+        selectorVersion++;
+    }
+
+    NetlistEdge& addEdge(NetlistNode& sourceNode, NetlistNode& targetNode) {
+        // Placeholder nodes in a fragment aren't part of the node list.
+        if (isFragment)
+            return sourceNode.addEdge(targetNode);
+        return DirectedGraph<NetlistNode, NetlistEdge>::addEdge(sourceNode, targetNode);
+    }
 
     NetlistEdge& addEdge(NetlistNode& sourceNode, NetlistNode& targetNode, ast::EdgeKind edgeKind) {
-        auto& edge = DirectedGraph<NetlistNode, NetlistEdge>::addEdge(sourceNode, targetNode);
+        auto& edge = addEdge(sourceNode, targetNode);
         targetNode.edgeKind = edgeKind;
         return edge;
     }
 
+    /// Remove a node from the netlist, including all of its incident edges and
+    /// any index entries that refer to it. Return true if the node existed and
+    /// was removed.
+    bool removeNode(NetlistNode& node) {
+        if (node.kind == NodeKind::PortDeclaration) {
+            auto& portDecl = node.as<NetlistPortDeclaration>();
+            if (auto it = portIndex.find(portDecl.hierarchicalPath);
+                it != portIndex.end() && it->second == &portDecl) {
+                portIndex.erase(it);
+            }
+        }
+        else if (node.kind == NodeKind::VariableDeclaration) {
+            auto& varDecl = node.as<NetlistVariableDeclaration>();
+            if (auto it = variableIndex.find(varDecl.hierarchicalPath);
+                it != variableIndex.end() && it->second == &varDecl) {
+                variableIndex.erase(it);
+            }
+        }
+
+        variableReferenceIndex.clear();
+        variableReferenceIndexValid = false;
+        return DirectedGraph<NetlistNode, NetlistEdge>::removeNode(node);
+    }
+
     /// Find a port declaration node in the netlist by hierarchical path.
     NetlistPortDeclaration* lookupPort(std::string_view hierarchicalPath) {
-        auto compareNode = [&hierarchicalPath](const std::unique_ptr<NetlistNode>& node) {
-            return node->kind == NodeKind::PortDeclaration &&
-                   node->as<NetlistPortDeclaration>().hierarchicalPath == hierarchicalPath;
-        };
-        auto it = std::ranges::find_if(*this, compareNode);
-        return it != end() ? &it->get()->as<NetlistPortDeclaration>() : nullptr;
+        auto it = portIndex.find(hierarchicalPath);
+        return it != portIndex.end() ? it->second : nullptr;
     }
 
     /// Find a variable declaration node in the netlist by hierarchical path.
     /// Note that this does not lookup alias nodes.
     NetlistVariableDeclaration* lookupVariable(std::string_view hierarchicalPath) {
-        auto compareNode = [&hierarchicalPath](const std::unique_ptr<NetlistNode>& node) {
-            return node->kind == NodeKind::VariableDeclaration &&
-                   node->as<NetlistVariableDeclaration>().hierarchicalPath == hierarchicalPath;
+        auto it = variableIndex.find(hierarchicalPath);
+        return it != variableIndex.end() ? it->second : nullptr;
+    }
+
+    /// Find the variable declaration node corresponding to a symbol. In a
+    /// fragment, this returns a placeholder node if the variable isn't declared
+    /// in the fragment itself.
+    NetlistVariableDeclaration* lookupVariable(const ast::Symbol& symbol) {
+        auto hierPath = resolveSymbolHierPath(symbol);
+        if (auto* result = lookupVariable(hierPath))
+            return result;
+
+        if (!isFragment)
+            return nullptr;
+
+        if (auto it = placeholderIndex.find(hierPath); it != placeholderIndex.end())
+            return it->second;
+
+        auto& placeholder = placeholders.emplace_back(
+            std::make_unique<NetlistVariableDeclaration>(symbol));
+        placeholder->hierarchicalPath = std::move(hierPath);
+        placeholderIndex.emplace(placeholder->hierarchicalPath, placeholder.get());
+        return placeholder.get();
+    }
+
+    /// Move the nodes and edges of a fragment into this netlist, resolving the
+    /// fragment's placeholder nodes. Merging a sequence of fragments in order
+    /// gives the same netlist as building their contents directly, in the same
+    /// order: declarations that already exist here are reused rather than
+    /// duplicated, each node's outgoing edges keep the order in which they were
+    /// added, and nodes are numbered in order.
+    void mergeFragment(Netlist& fragment) {
+        SLANG_ASSERT(fragment.isFragment && !isFragment);
+
+        // Nodes of the fragment that are replaced by nodes of this netlist.
+        flat_hash_map<const NetlistNode*, NetlistNode*> replacements;
+        std::vector<std::unique_ptr<NetlistNode>> replaced;
+        auto firstNode = nodes.size();
+        for (auto& node : fragment.nodes) {
+            if (node->kind == NodeKind::VariableDeclaration) {
+                auto& varDecl = node->as<NetlistVariableDeclaration>();
+                if (auto* existing = lookupVariable(varDecl.hierarchicalPath)) {
+                    replacements.emplace(node.get(), existing);
+                    replaced.push_back(std::move(node));
+                    continue;
+                }
+                variableIndex.emplace(varDecl.hierarchicalPath, &varDecl);
+            }
+            else if (node->kind == NodeKind::PortDeclaration) {
+                auto& portDecl = node->as<NetlistPortDeclaration>();
+                [[maybe_unused]] auto inserted =
+                    portIndex.emplace(portDecl.hierarchicalPath, &portDecl).second;
+                SLANG_ASSERT(inserted && "Port declaration already exists");
+            }
+            node->ID = ++NetlistNode::nextID;
+            nodes.push_back(std::move(node));
+        }
+
+        for (auto& placeholder : fragment.placeholders) {
+            auto* existing = lookupVariable(placeholder->hierarchicalPath);
+            SLANG_ASSERT(existing && "Variable declaration does not exist");
+            replacements.emplace(placeholder.get(), existing);
+            replaced.push_back(std::move(placeholder));
+        }
+
+        auto resolve = [&](NetlistNode& node) -> NetlistNode& {
+            auto it = replacements.find(&node);
+            return it != replacements.end() ? *it->second : node;
         };
-        auto it = std::ranges::find_if(*this, compareNode);
-        return it != end() ? &it->get()->as<NetlistVariableDeclaration>() : nullptr;
+
+        // Redirect edges that target replaced nodes. Edges can't be retargeted
+        // in place, so the edge list of any affected node is rebuilt in order.
+        std::vector<NetlistNode*> targets;
+        for (auto i = firstNode; i < nodes.size(); i++) {
+            auto& node = *nodes[i];
+            if (std::ranges::none_of(node.getEdges(), [&](auto& edge) {
+                    return replacements.contains(&edge->getTargetNode());
+                })) {
+                continue;
+            }
+
+            for (auto& edge : node.getEdges())
+                targets.push_back(&resolve(edge->getTargetNode()));
+            node.clearEdges();
+            for (auto* target : targets)
+                node.addEdge(*target);
+            targets.clear();
+        }
+
+        // Edges outgoing from replaced nodes are appended to their replacements.
+        // Only variable references are given edge kinds, so replaced nodes don't
+        // carry any state other than their edges.
+        for (auto& node : replaced) {
+            SLANG_ASSERT(node->edgeKind == ast::EdgeKind::None);
+            auto& replacement = resolve(*node);
+            for (auto& edge : node->getEdges())
+                replacement.addEdge(resolve(edge->getTargetNode()));
+        }
+
+        fragment.nodes.clear();
+        fragment.placeholders.clear();
+        fragment.variableIndex.clear();
+        fragment.portIndex.clear();
+        fragment.placeholderIndex.clear();
     }
 
     /// Find a variable reference node in the netlist by its syntax.
     /// Note that this does not include the hierarchical path, which is only
     /// associated with the corresponding variable declaration nodes.
+    /// Selectors are added to reference nodes after they are created, so the
+    /// index used here is rebuilt on the first lookup after any nodes or
+    /// selectors have been added to or removed from this netlist; lookups
+    /// should be made once the netlist has been built.
     NetlistVariableReference* lookupVariableReference(std::string_view syntax) {
-        auto compareNode = [&syntax](const std::unique_ptr<NetlistNode>& node) {
-            return node->kind == NodeKind::VariableReference &&
-                   node->as<NetlistVariableReference>().toString() == syntax;
-        };
-        auto it = std::ranges::find_if(*this, compareNode);
-        return it != end() ? &it->get()->as<NetlistVariableReference>() : nullptr;
+        if (!variableReferenceIndexValid || numIndexedNodes != nodes.size() ||
+            indexedSelectorVersion != selectorVersion) {
+            variableReferenceIndex.clear();
+            for (auto& node : nodes) {
+                if (node->kind == NodeKind::VariableReference) {
+                    auto& varRef = node->as<NetlistVariableReference>();
+                    variableReferenceIndex.try_emplace(varRef.toString(), &varRef);
+                }
+            }
+            variableReferenceIndexValid = true;
+            numIndexedNodes = nodes.size();
+            indexedSelectorVersion = selectorVersion;
+        }
+
+        auto it = variableReferenceIndex.find(std::string(syntax));
+        return it != variableReferenceIndex.end() ? it->second : nullptr;
     }
 
     /// Perform a transformation on the netlist graph to split variable /
@@ -460,6 +622,13 @@ public:
     void split() {
         std::vector<std::tuple<NetlistVariableDeclaration*, NetlistEdge*, NetlistEdge*>>
             modifications;
+        // Collect the incoming edges of every node up front, rather than
+        // scanning the whole graph once per variable declaration.
+        flat_hash_map<const NetlistNode*, std::vector<NetlistEdge*>> inEdgeMap;
+        for (auto& node : nodes) {
+            for (auto& edge : *node)
+                inEdgeMap[&edge->getTargetNode()].push_back(edge.get());
+        }
         // Find each variable declaration nodes in the graph that has multiple
         // outgoing edges.
         for (auto& node : nodes) {
@@ -468,8 +637,7 @@ public:
                 auto& varType = varDeclNode.symbol.getDeclaredType()->getType();
                 DEBUG_PRINT("Variable {} has type {}\n", varDeclNode.hierarchicalPath,
                             varType.toString());
-                std::vector<NetlistEdge*> inEdges;
-                getInEdgesToNode(*node, inEdges);
+                auto& inEdges = inEdgeMap[node.get()];
                 // Find pairs of input and output edges that are attached to variable
                 // refertence nodes. Eg.
                 //   var ref -> var decl -> var ref
@@ -513,6 +681,36 @@ public:
             varAliasNode.addEdge(outEdge->getTargetNode());
         }
     }
+
+    /// Convert the netlist into a compact form for fast traversal, leaving out
+    /// disabled edges. This should be done once the netlist has been built and
+    /// split, since later changes to the netlist aren't reflected.
+    FrozenNetlist freeze() const {
+        return FrozenNetlist(*this, [](const NetlistEdge& edge) { return !edge.disabled; });
+    }
+
+private:
+    // Indexes of declaration nodes by hierarchical path. The keys refer to the
+    // path strings owned by the nodes themselves.
+    flat_hash_map<std::string_view, NetlistPortDeclaration*> portIndex;
+    flat_hash_map<std::string_view, NetlistVariableDeclaration*> variableIndex;
+
+    // Index of variable reference nodes by their syntax string, built lazily,
+    // along with the state of the netlist it was built from.
+    flat_hash_map<std::string, NetlistVariableReference*> variableReferenceIndex;
+    bool variableReferenceIndexValid = false;
+    size_t numIndexedNodes = 0;
+    uint64_t indexedSelectorVersion = 0;
+
+    // Incremented whenever a selector is added to one of this netlist's
+    // variable references, which changes the string it is indexed by.
+    uint64_t selectorVersion = 0;
+
+    // Whether this is a fragment, and if so the placeholder nodes standing in
+    // for variables declared outside of it, indexed by hierarchical path.
+    bool isFragment = false;
+    std::vector<std::unique_ptr<NetlistVariableDeclaration>> placeholders;
+    flat_hash_map<std::string_view, NetlistVariableDeclaration*> placeholderIndex;
 };
 
 } // namespace netlist
@@ -0,0 +1,118 @@
+//------------------------------------------------------------------------------
+//! @file NetlistOutput.h
+//! @brief Streaming output of the netlist in DOT and binary edge list formats
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include "Netlist.h"
+#include "fmt/format.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+namespace netlist {
+
+/// Writes to a file through a fixed-size buffer, so that large outputs are
+/// streamed to the file as they're produced rather than being built up in
+/// memory first. The file name '-' refers to stdout. Errors are reported by
+/// throwing std::runtime_error.
+class OutputFile {
+public:
+    static constexpr size_t DefaultBufferSize = 1 << 16;
+
+    explicit OutputFile(const std::string& fileName, size_t bufferSize = DefaultBufferSize);
+    ~OutputFile();
+
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+
+    /// Write a string.
+    void write(std::string_view text) { write(text.data(), text.size()); }
+
+    /// Write a block of raw bytes.
+    void write(const void* data, size_t size) {
+        auto bytes = static_cast<const char*>(data);
+        buffer.append(bytes, bytes + size);
+        if (buffer.size() >= bufferSize)
+            flush();
+    }
+
+    /// Write formatted text.
+    template<typename... Args>
+    void format(fmt::format_string<Args...> fmt, Args&&... args) {
+        fmt::format_to(fmt::appender(buffer), fmt, std::forward<Args>(args)...);
+        if (buffer.size() >= bufferSize)
+            flush();
+    }
+
+    /// Write out any buffered output.
+    void flush();
+
+    /// Flush any buffered output and close the file.
+    void close();
+
+private:
+    std::string fileName;
+    std::FILE* file;
+    fmt::memory_buffer buffer;
+    size_t bufferSize;
+};
+
+/// Write the netlist in Graphviz DOT format. Disabled edges are left out.
+void writeDOT(const Netlist& netlist, OutputFile& output);
+
+/// The binary edge list format written by writeEdgeList, which is designed so
+/// that tools can memory map the file and use it in place. The file consists
+/// of an EdgeListHeader, followed by a table of EdgeListNode records, a table
+/// of EdgeListEdge records, and a table of strings. Each section is a multiple
+/// of eight bytes in size (the string table is padded with zeros) so every
+/// record is naturally aligned. All values are in host byte order; readers
+/// can detect a mismatch by checking the version field.
+struct EdgeListHeader {
+    static constexpr char Magic[8] = {'S', 'L', 'N', 'E', 'T', 'E', 'L', '\0'};
+    static constexpr uint32_t Version = 1;
+
+    char magic[8];
+    uint32_t version;
+    uint32_t reserved;
+    uint64_t numNodes;
+    uint64_t numEdges;
+    /// The size of the string table in bytes, including padding.
+    uint64_t stringTableSize;
+};
+
+/// A node in the binary edge list. Nodes are numbered by their position in
+/// the node table, which is the same order as in the netlist.
+struct EdgeListNode {
+    /// The offset of the node's name in the string table. Names are the
+    /// hierarchical paths of declarations and the source text of variable
+    /// references, and are followed by a null terminator.
+    uint64_t nameOffset;
+    uint32_t nameLength;
+    /// The NodeKind of the node.
+    uint8_t kind;
+    /// The ast::EdgeKind for assignments to variable references.
+    uint8_t edgeKind;
+    /// Bit zero is set for variable references that are assigned to.
+    uint16_t flags;
+};
+
+/// An edge in the binary edge list, from one node number to another. Edges
+/// are sorted by their source node. Disabled edges are left out.
+struct EdgeListEdge {
+    uint32_t source;
+    uint32_t target;
+};
+
+static_assert(sizeof(EdgeListHeader) == 40);
+static_assert(sizeof(EdgeListNode) == 16);
+static_assert(sizeof(EdgeListEdge) == 8);
+
+/// Write the netlist in the binary edge list format.
+void writeEdgeList(const FrozenNetlist& netlist, OutputFile& output);
+
+} // namespace netlist
@@ -10,7 +10,7 @@
 #include "DepthFirstSearch.h"
 #include "Netlist.h"
 #include "NetlistPath.h"
-#include <map>
+#include <optional>
 #include <vector>
 
 #include "slang/util/Util.h"
@@ -20,59 +20,60 @@ namespace netlist {
 /// Find a path between two points in a netlist.
 class PathFinder {
 private:
+    using node_id = FrozenNetlist::node_id;
+
     /// Depth-first traversal produces a tree sub graph and as such, each node
-    /// can only have one parent node. This map captures these relationships and
-    /// is used to determine paths between leaf nodes and the root node of the
-    /// tree.
-    using TraversalMap = std::map<NetlistNode*, NetlistNode*>;
+    /// can only have one parent node. This array, indexed by node ID, captures
+    /// these relationships and is used to determine paths between leaf nodes
+    /// and the root node of the tree.
+    using TraversalMap = std::vector<node_id>;
 
-    /// A visitor for the search that constructs the traversal map.
+    /// A visitor for the search that constructs the traversal map, stopping
+    /// once the end node has been reached.
     class Visitor {
     public:
-        Visitor(Netlist& netlist, TraversalMap& traversalMap) :
-            netlist(netlist), traversalMap(traversalMap) {}
-        void visitNode(NetlistNode& node) {}
-        void visitEdge(NetlistEdge& edge) {
-            auto* sourceNode = &edge.getSourceNode();
-            auto* targetNode = &edge.getTargetNode();
-            SLANG_ASSERT(traversalMap.count(targetNode) == 0 && "node cannot have two parents");
+        Visitor(TraversalMap& traversalMap, node_id endNode) :
+            traversalMap(traversalMap), endNode(endNode) {}
+        bool visitNode(node_id node) { return node != endNode; }
+        void visitEdge(node_id sourceNode, node_id targetNode) {
+            SLANG_ASSERT(traversalMap[targetNode] == FrozenNetlist::null_node &&
+                         "node cannot have two parents");
             traversalMap[targetNode] = sourceNode;
         }
 
     private:
-        Netlist& netlist;
         TraversalMap& traversalMap;
-    };
-
-    /// A selector for edges that can be traversed in the search.
-    struct EdgePredicate {
-        EdgePredicate() = default;
-        bool operator()(const NetlistEdge& edge) { return !edge.disabled; }
+        node_id endNode;
     };
 
 public:
-    PathFinder(Netlist& netlist) : netlist(netlist) {}
+    /// Construct a path finder that freezes @a netlist when it is first queried.
+    PathFinder(Netlist& netlist) : netlist(&netlist) {}
+
+    /// Construct a path finder that searches an already frozen netlist.
+    PathFinder(const FrozenNetlist& graph) : graph(&graph) {}
 
-    NetlistPath buildPath(TraversalMap& traversalMap, NetlistNode& startNode,
-                          NetlistNode& endNode) {
+    NetlistPath buildPath(const TraversalMap& traversalMap, node_id startNode,
+                          node_id endNode) const {
         // Empty path.
-        if (traversalMap.count(&endNode) == 0) {
+        if (traversalMap[endNode] == FrozenNetlist::null_node) {
             return NetlistPath();
         }
         // Single-node path.
         if (startNode == endNode) {
-            return NetlistPath({&endNode});
+            return NetlistPath({&graph->getNode(endNode)});
         }
         // Multi-node path.
         NetlistPath path;
-        auto* nextNode = &endNode;
+        auto nextNode = endNode;
         do {
             nextNode = traversalMap[nextNode];
             // Add only the variable references to the path.
-            if (nextNode->kind == NodeKind::VariableReference) {
-                path.add(*nextNode);
+            auto& node = graph->getNode(nextNode);
+            if (node.kind == NodeKind::VariableReference) {
+                path.add(node);
             }
-        } while (nextNode != &startNode);
+        } while (nextNode != startNode);
         path.reverse();
         return path;
     }
@@ -80,14 +81,25 @@ public:
     /// Find a path between two nodes in the netlist.
     /// Return a NetlistPath object that is empty if the path does not exist.
     NetlistPath find(NetlistNode& startNode, NetlistNode& endNode) {
-        TraversalMap traversalMap;
-        Visitor visitor(netlist, traversalMap);
-        DepthFirstSearch<NetlistNode, NetlistEdge, Visitor, EdgePredicate> dfs(visitor, startNode);
-        return buildPath(traversalMap, startNode, endNode);
+        if (!graph) {
+            frozenNetlist.emplace(netlist->freeze());
+            graph = &*frozenNetlist;
+        }
+
+        auto startId = graph->getId(startNode);
+        auto endId = graph->getId(endNode);
+        SLANG_ASSERT(startId != FrozenNetlist::null_node && endId != FrozenNetlist::null_node);
+
+        TraversalMap traversalMap(graph->numNodes(), FrozenNetlist::null_node);
+        Visitor visitor(traversalMap, endId);
+        CompactDepthFirstSearch<FrozenNetlist, Visitor> dfs(visitor, *graph, startId);
+        return buildPath(traversalMap, startId, endId);
     }
 
 private:
-    Netlist& netlist;
+    Netlist* netlist = nullptr;
+    const FrozenNetlist* graph = nullptr;
+    std::optional<FrozenNetlist> frozenNetlist;
 };
 
 } // namespace netlist
@@ -23,14 +23,14 @@ public:
         netlist(netlist), evalCtx(evalCtx), condVars(condVars) {}
 
     void connectDeclToVar(NetlistNode& declNode, const ast::Symbol& variable) {
-        auto* varNode = netlist.lookupVariable(resolveSymbolHierPath(variable));
+        auto* varNode = netlist.lookupVariable(variable);
         netlist.addEdge(*varNode, declNode);
         DEBUG_PRINT("New edge: from declaration {} -> reference {}\n", varNode->hierarchicalPath,
                     declNode.getName());
     }
 
     void connectVarToDecl(NetlistNode& varNode, const ast::Symbol& declaration) {
-        auto* declNode = netlist.lookupVariable(resolveSymbolHierPath(declaration));
+        auto* declNode = netlist.lookupVariable(declaration);
         netlist.addEdge(varNode, *declNode);
         DEBUG_PRINT("New edge: reference {} -> declaration {}\n", varNode.getName(),
                     declNode->hierarchicalPath);
@@ -9,29 +9,47 @@
 
 #include "visitors/ContinuousAssignVisitor.hpp"
 #include "visitors/GenerateBlockVisitor.hpp"
+#include <functional>
+#include <vector>
 
 using namespace slang;
 
 namespace netlist {
 
+/// A unit of work in building a netlist, which adds nodes and edges to the
+/// netlist (or netlist fragment) it is given.
+using NetlistBuildTask = std::function<void(Netlist&)>;
+
 /// Visit module and interface instances to perform hookup of external
 /// variables to the corresponding ports and then to internally-scoped
 /// variables mirroring the ports.
 class InstanceVisitor : public ast::ASTVisitor<InstanceVisitor, true, false> {
 public:
-    explicit InstanceVisitor(ast::Compilation& compilation, Netlist& netlist) :
-        compilation(compilation), netlist(netlist) {}
+    /// If @a tasks is given, the work of building the netlist is added to it
+    /// as a sequence of tasks, in the order it would otherwise have been done,
+    /// rather than being done as the instances are visited.
+    explicit InstanceVisitor(ast::Compilation& compilation, Netlist& netlist,
+                             std::vector<NetlistBuildTask>* tasks = nullptr) :
+        compilation(compilation), netlist(netlist), tasks(tasks) {}
 
 private:
+    template<typename TFunc>
+    void schedule(TFunc&& task) {
+        if (tasks)
+            tasks->emplace_back(std::forward<TFunc>(task));
+        else
+            task(netlist);
+    }
+
     void connectDeclToVar(NetlistNode& declNode, const ast::Symbol& variable) {
-        auto* varNode = netlist.lookupVariable(resolveSymbolHierPath(variable));
+        auto* varNode = netlist.lookupVariable(variable);
         netlist.addEdge(*varNode, declNode);
         DEBUG_PRINT("New edge: from declaration {} to reference {}\n", varNode->hierarchicalPath,
                     declNode.getName());
     }
 
     void connectVarToDecl(NetlistNode& varNode, const ast::Symbol& declaration) {
-        auto* declNode = netlist.lookupVariable(resolveSymbolHierPath(declaration));
+        auto* declNode = netlist.lookupVariable(declaration);
         netlist.addEdge(varNode, *declNode);
         DEBUG_PRINT("New edge: reference {} to declaration {}\n", varNode.getName(),
                     declNode->hierarchicalPath);
@@ -198,39 +216,50 @@ public:
             return;
         }
 
-        handleInstanceMemberVars(symbol);
-        handleInstanceMemberPorts(symbol);
-        handleInstanceExtPorts(symbol);
+        schedule([&compilation = compilation, &symbol](Netlist& netlist) {
+            InstanceVisitor visitor(compilation, netlist);
+            visitor.handleInstanceMemberVars(symbol);
+            visitor.handleInstanceMemberPorts(symbol);
+            visitor.handleInstanceExtPorts(symbol);
+        });
 
         symbol.body.visit(*this);
     }
 
     /// Procedural block.
     void handle(const ast::ProceduralBlockSymbol& symbol) {
-        ProceduralBlockVisitor visitor(compilation, netlist,
-                                       ProceduralBlockVisitor::determineEdgeKind(symbol));
-        symbol.visit(visitor);
+        schedule([&compilation = compilation, &symbol](Netlist& netlist) {
+            ProceduralBlockVisitor visitor(compilation, netlist,
+                                           ProceduralBlockVisitor::determineEdgeKind(symbol));
+            symbol.visit(visitor);
+        });
     }
 
     /// Generate block.
     void handle(const ast::GenerateBlockSymbol& symbol) {
         if (!symbol.isUninstantiated) {
-            GenerateBlockVisitor visitor(compilation, netlist);
-            symbol.visit(visitor);
+            schedule([&compilation = compilation, &symbol](Netlist& netlist) {
+                GenerateBlockVisitor visitor(compilation, netlist);
+                symbol.visit(visitor);
+            });
         }
     }
 
     /// Continuous assignment statement.
     void handle(const ast::ContinuousAssignSymbol& symbol) {
-        ast::EvalContext evalCtx(ast::ASTContext(compilation.getRoot(), ast::LookupLocation::max));
-        SmallVector<NetlistNode*> condVars;
-        ContinuousAssignVisitor visitor(netlist, evalCtx, condVars);
-        symbol.visit(visitor);
+        schedule([&compilation = compilation, &symbol](Netlist& netlist) {
+            ast::EvalContext evalCtx(
+                ast::ASTContext(compilation.getRoot(), ast::LookupLocation::max));
+            SmallVector<NetlistNode*> condVars;
+            ContinuousAssignVisitor visitor(netlist, evalCtx, condVars);
+            symbol.visit(visitor);
+        });
     }
 
 private:
     ast::Compilation& compilation;
     Netlist& netlist;
+    std::vector<NetlistBuildTask>* tasks;
 };
 
 } // namespace netlist
@@ -15,6 +15,8 @@
 #include "visitors/InstanceVisitor.hpp"
 #include <algorithm>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 #include "slang/ast/ASTContext.h"
 #include "slang/ast/ASTVisitor.h"
@@ -24,8 +26,10 @@
 #include "slang/ast/expressions/AssignmentExpressions.h"
 #include "slang/ast/symbols/BlockSymbols.h"
 #include "slang/ast/symbols/CompilationUnitSymbols.h"
+#include "slang/ast/symbols/SubroutineSymbols.h"
 #include "slang/ast/symbols/ValueSymbol.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
+#include "slang/util/ThreadPool.h"
 #include "slang/util/Util.h"
 
 using namespace slang;
@@ -35,17 +39,97 @@ namespace netlist {
 /// The top-level visitor that traverses the AST and builds a netlist connectivity graph.
 class NetlistVisitor : public ast::ASTVisitor<NetlistVisitor, true, false> {
 public:
-    explicit NetlistVisitor(ast::Compilation& compilation, Netlist& netlist) :
-        compilation(compilation), netlist(netlist) {}
+    /// If @a tasks is given, the work of building the netlist is collected
+    /// into it instead of being done directly (see InstanceVisitor).
+    explicit NetlistVisitor(ast::Compilation& compilation, Netlist& netlist,
+                            std::vector<NetlistBuildTask>* tasks = nullptr) :
+        compilation(compilation), netlist(netlist), tasks(tasks) {}
 
     void handle(const ast::InstanceSymbol& symbol) {
-        InstanceVisitor visitor(compilation, netlist);
+        InstanceVisitor visitor(compilation, netlist, tasks);
         symbol.visit(visitor);
     }
 
 private:
     ast::Compilation& compilation;
     Netlist& netlist;
+    std::vector<NetlistBuildTask>* tasks;
 };
 
+/// Computes the state that constant evaluation caches lazily on each function
+/// (its bytecode and whether its calls can be memoized) ahead of time, so that
+/// it is only ever read while the netlist is being built in parallel.
+class ConstantEvalCacheVisitor : public ast::ASTVisitor<ConstantEvalCacheVisitor, true, false> {
+public:
+    explicit ConstantEvalCacheVisitor(ast::Compilation& compilation) :
+        bytecode(compilation.hasFlag(ast::CompilationFlags::ConstexprBytecode)),
+        memoize(compilation.getOptions().maxConstexprMemo > 0) {}
+
+    void handle(const ast::SubroutineSymbol& symbol) {
+        // Only functions with a return value can be called in a constant
+        // expression; class constructors, for example, don't have one.
+        if (symbol.subroutineKind == ast::SubroutineKind::Function && symbol.returnValVar) {
+            if (bytecode)
+                symbol.getConstantBytecode();
+            if (memoize)
+                symbol.isMemoizable();
+        }
+        visitDefault(symbol);
+    }
+
+private:
+    bool bytecode;
+    bool memoize;
+};
+
+/// Build the netlist for a design using @a numThreads threads (zero uses the
+/// hardware concurrency). The result is identical to building it serially with
+/// a NetlistVisitor.
+///
+/// The work done for each instance header (its declarations and port
+/// connections), procedural block, continuous assignment and generate block is
+/// collected into a list of tasks in the order a serial build would do it.
+/// Contiguous blocks of tasks are then built into separate netlist fragments in
+/// parallel, and the fragments are merged into the netlist in order, which is
+/// where references between them are resolved.
+inline void buildNetlist(ast::Compilation& compilation, Netlist& netlist, uint32_t numThreads) {
+    if (numThreads == 1) {
+        NetlistVisitor visitor(compilation, netlist);
+        compilation.getRoot().visit(visitor);
+        return;
+    }
+
+    // The AST is elaborated lazily, so make sure it has been fully elaborated
+    // before it is visited from multiple threads. Worker threads evaluate
+    // constant expressions, so also fill in the per-function caches that
+    // evaluation would otherwise compute on first use.
+    compilation.getAllDiagnostics();
+    ConstantEvalCacheVisitor cacheVisitor(compilation);
+    compilation.getRoot().visit(cacheVisitor);
+    for (auto package : compilation.getPackages())
+        package->visit(cacheVisitor);
+
+    std::vector<NetlistBuildTask> tasks;
+    NetlistVisitor visitor(compilation, netlist, &tasks);
+    compilation.getRoot().visit(visitor);
+
+    auto firstID = NetlistNode::nextID.load();
+    std::vector<std::unique_ptr<Netlist>> fragments(tasks.size());
+    ThreadPool threadPool(numThreads);
+    threadPool.pushLoop(size_t(0), tasks.size(), [&](size_t start, size_t end) {
+        auto fragment = std::make_unique<Netlist>(Netlist::createFragment());
+        for (size_t i = start; i < end; i++)
+            tasks[i](*fragment);
+        fragments[start] = std::move(fragment);
+    });
+    threadPool.waitForAll();
+
+    // Renumber the nodes as they're merged, as though they had been created in order.
+    NetlistNode::nextID = firstID;
+    for (auto& fragment : fragments) {
+        if (fragment)
+            netlist.mergeFragment(*fragment);
+    }
+}
+
 } // namespace netlist
@@ -271,7 +271,7 @@ private:
     /// For the specified variable reference, create a dependency to the declaration or
     /// last definition.
     void connectVarToDecl(NetlistVariableReference& varNode, ast::Symbol const& symbol) {
-        auto* declNode = netlist.lookupVariable(resolveSymbolHierPath(symbol));
+        auto* declNode = netlist.lookupVariable(symbol);
         netlist.addEdge(varNode, *declNode);
         DEBUG_PRINT("New edge: reference {} -> declaration {}\n", varNode.getName(),
                     declNode->hierarchicalPath);
@@ -280,7 +280,7 @@ private:
     /// For the specified variable reference, create a dependency from the declaration or
     /// last definition.
     void connectDeclToVar(NetlistVariableReference& varNode, ast::Symbol const& symbol) {
-        auto* declNode = netlist.lookupVariable(resolveSymbolHierPath(symbol));
+        auto* declNode = netlist.lookupVariable(symbol);
         netlist.addEdge(*declNode, varNode);
         DEBUG_PRINT("New edge: declaration {} -> reference {}\n", declNode->hierarchicalPath,
                     varNode.getName());
@@ -34,16 +34,17 @@ public:
             if (selector->kind == ast::ExpressionKind::ElementSelect) {
                 const auto& expr = selector->as<ast::ElementSelectExpression>();
                 auto index = expr.selector().eval(evalCtx);
-                node.addElementSelect(expr, index);
+                netlist.addElementSelect(node, expr, index);
             }
             else if (selector->kind == ast::ExpressionKind::RangeSelect) {
                 const auto& expr = selector->as<ast::RangeSelectExpression>();
                 auto leftIndex = expr.left().eval(evalCtx);
                 auto rightIndex = expr.right().eval(evalCtx);
-                node.addRangeSelect(expr, leftIndex, rightIndex);
+                netlist.addRangeSelect(node, expr, leftIndex, rightIndex);
             }
             else if (selector->kind == ast::ExpressionKind::MemberAccess) {
-                node.addMemberAccess(selector->as<ast::MemberAccessExpression>().member.name);
+                netlist.addMemberAccess(node,
+                                        selector->as<ast::MemberAccessExpression>().member.name);
             }
         }
 
@@ -7,7 +7,9 @@
 //------------------------------------------------------------------------------
 
 #include "Netlist.h"
+#include "NetlistOutput.h"
 
+#include "CombLoopComponents.h"
 #include "CombLoops.h"
 #include "PathFinder.h"
 #include "fmt/color.h"
@@ -25,7 +27,6 @@
 #include "slang/diagnostics/DiagnosticEngine.h"
 #include "slang/diagnostics/Diagnostics.h"
 #include "slang/driver/Driver.h"
-#include "slang/text/FormatBuffer.h"
 #include "slang/text/Json.h"
 #include "slang/util/String.h"
 #include "slang/util/TimeTrace.h"
@@ -46,8 +47,11 @@ inline constexpr DiagCode VariableReference(DiagSubsystem::Netlist, 0);
 
 void printJson(Compilation& compilation, const std::string& fileName,
                const std::vector<std::string>& scopes) {
+    OutputFile output(fileName);
     JsonWriter writer;
     writer.setPrettyPrint(true);
+    writer.setOutput([&](std::string_view text) { output.write(text); },
+                     OutputFile::DefaultBufferSize);
     ASTSerializer serializer(compilation, writer);
     if (scopes.empty()) {
         serializer.serialize(compilation.getRoot());
@@ -60,58 +64,21 @@ void printJson(Compilation& compilation, const std::string& fileName,
             }
         }
     }
-    OS::writeFile(fileName, writer.view());
+    writer.flush();
+    output.write(writer.view());
+    output.close();
 }
 
 void printDOT(const Netlist& netlist, const std::string& fileName) {
-    slang::FormatBuffer buffer;
-    buffer.append("digraph {\n");
-    buffer.append("  node [shape=record];\n");
-    for (auto& node : netlist) {
-        switch (node->kind) {
-            case NodeKind::PortDeclaration: {
-                auto& portDecl = node->as<NetlistPortDeclaration>();
-                buffer.format("  N{} [label=\"Port declaration\\n{}\"]\n", node->ID,
-                              portDecl.hierarchicalPath);
-                break;
-            }
-            case NodeKind::VariableDeclaration: {
-                auto& varDecl = node->as<NetlistVariableDeclaration>();
-                buffer.format("  N{} [label=\"Variable declaration\\n{}\"]\n", node->ID,
-                              varDecl.hierarchicalPath);
-                break;
-            }
-            case NodeKind::VariableAlias: {
-                auto& varAlias = node->as<NetlistVariableAlias>();
-                buffer.format("  N{} [label=\"Variable alias\\n{}\"]\n", node->ID,
-                              varAlias.hierarchicalPath);
-                break;
-            }
-            case NodeKind::VariableReference: {
-                auto& varRef = node->as<NetlistVariableReference>();
-                if (!varRef.isLeftOperand())
-                    buffer.format("  N{} [label=\"{}\\n\"]\n", node->ID, varRef.toString());
-                else if (node->edgeKind == EdgeKind::None)
-                    buffer.format("  N{} [label=\"{}\\n[Assigned to]\"]\n", node->ID,
-                                  varRef.toString());
-                else
-                    buffer.format("  N{} [label=\"{}\\n[Assigned to @({})]\"]\n", node->ID,
-                                  varRef.toString(), toString(node->edgeKind));
-                break;
-            }
-            default:
-                SLANG_UNREACHABLE;
-        }
-    }
-    for (auto& node : netlist) {
-        for (auto& edge : node->getEdges()) {
-            if (!edge->disabled) {
-                buffer.format("  N{} -> N{}\n", node->ID, edge->getTargetNode().ID);
-            }
-        }
-    }
-    buffer.append("}\n");
-    OS::writeFile(fileName, buffer.str());
+    OutputFile output(fileName);
+    writeDOT(netlist, output);
+    output.close();
+}
+
+void printEdgeList(const FrozenNetlist& netlist, const std::string& fileName) {
+    OutputFile output(fileName);
+    writeEdgeList(netlist, output);
+    output.close();
 }
 
 void reportPath(Compilation& compilation, const NetlistPath& path) {
@@ -167,6 +134,38 @@ void dumpCyclesList(Compilation& compilation, Netlist& netlist,
     }
 }
 
+void dumpLoopComponents(Compilation& compilation, Netlist& netlist,
+                        const std::vector<LoopComponent>& components) {
+    auto s = components.size();
+    if (!s) {
+        OS::print("No combinatorial loops detected\n");
+        return;
+    }
+    OS::print(fmt::format("Detected {} group{} of combinatorial loops:\n", s, (s > 1) ? "s" : ""));
+    NetlistPath path;
+    for (auto& component : components) {
+        auto n = component.cycles.size();
+        if (component.limitReached)
+            OS::print(fmt::format("Group of {} nodes, showing first {} loop{}:\n",
+                                  component.nodes.size(), n, (n > 1) ? "s" : ""));
+        else
+            OS::print(fmt::format("Group of {} nodes with {} loop{}:\n", component.nodes.size(),
+                                  n, (n > 1) ? "s" : ""));
+
+        for (auto& cycle : component.cycles) {
+            for (auto id : cycle) {
+                auto& node = netlist.getNode(id);
+                if (node.kind == NodeKind::VariableReference) {
+                    path.add(node);
+                }
+            }
+            OS::print(fmt::format("Path length: {}\n", path.size()));
+            reportPath(compilation, path);
+            path.clear();
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     OS::setupConsole();
 
@@ -184,6 +183,18 @@ int main(int argc, char** argv) {
     driver.cmdLine.add("-d,--debug", debug, "Output debugging information");
     driver.cmdLine.add("-c,--comb-loops", combLoops, "Detect combinatorial loops");
 
+    std::optional<uint32_t> maxLoopCycles;
+    driver.cmdLine.add("--max-loop-cycles", maxLoopCycles,
+                       "Maximum number of combinatorial loops to report for each group of "
+                       "connected nodes (default: 1), or 0 to report every loop",
+                       "<count>");
+
+    std::optional<bool> elementaryCycles;
+    driver.cmdLine.add("--elementary-cycles", elementaryCycles,
+                       "With --comb-loops, list every combinatorial loop in the netlist "
+                       "individually, by enumerating all elementary cycles (this can be very "
+                       "slow for large designs)");
+
     std::optional<std::string> astJsonFile;
     driver.cmdLine.add(
         "--ast-json", astJsonFile,
@@ -201,6 +212,12 @@ int main(int argc, char** argv) {
                        "Dump the netlist in DOT format to the specified file, or '-' for stdout",
                        "<file>", CommandLineFlags::FilePath);
 
+    std::optional<std::string> netlistEdgesFile;
+    driver.cmdLine.add("--netlist-edges", netlistEdgesFile,
+                       "Dump the netlist as a binary edge list to the specified file, or '-' "
+                       "for stdout",
+                       "<file>", CommandLineFlags::FilePath);
+
     std::optional<std::string> fromPointName;
     driver.cmdLine.add("--from", fromPointName, "Specify a start point from which to trace a path",
                        "<name>");
@@ -255,10 +272,10 @@ int main(int argc, char** argv) {
 
         qihe::Timer timer(__PRETTY_FUNCTION__);
 
-        // Create the netlist by traversing the AST.
+        // Create the netlist by traversing the AST. This is only done in
+        // parallel when a thread count is given explicitly.
         Netlist netlist;
-        NetlistVisitor visitor(*compilation, netlist);
-        compilation->getRoot().visit(visitor);
+        buildNetlist(*compilation, netlist, driver.options.numThreads.value_or(1));
         netlist.split();
         DEBUG_PRINT("Netlist has {} nodes and {} edges\n", netlist.numNodes(), netlist.numEdges());
 
@@ -270,11 +287,29 @@ int main(int argc, char** argv) {
             return 0;
         }
 
+        // Convert the netlist into a compact form for the traversals below.
+        auto frozenNetlist = netlist.freeze();
+
+        // Output a binary edge list of the netlist.
+        if (netlistEdgesFile) {
+            printEdgeList(frozenNetlist, *netlistEdgesFile);
+            return 0;
+        }
+
         if (combLoops == true) {
             qihe::Timer loopTimer("LoopCheck");
-            ElementaryCyclesSearch ecs(netlist);
-            std::vector<CycleListType>* cycles = ecs.getElementaryCycles();
-            dumpCyclesList(*compilation, netlist, cycles);
+            if (elementaryCycles == true) {
+                ElementaryCyclesSearch ecs(netlist);
+                std::vector<CycleListType>* cycles = ecs.getElementaryCycles();
+                dumpCyclesList(*compilation, netlist, cycles);
+            }
+            else {
+                LoopComponentOptions loopOptions;
+                loopOptions.maxCyclesPerComponent = maxLoopCycles.value_or(1);
+                loopOptions.numThreads = driver.options.numThreads.value_or(1);
+                auto components = LoopComponentSearch(frozenNetlist).find(loopOptions);
+                dumpLoopComponents(*compilation, netlist, components);
+            }
             loopTimer.tick();
         }
         // Find a point-to-point path in the netlist.
@@ -295,7 +330,7 @@ int main(int argc, char** argv) {
                 SLANG_THROW(std::runtime_error(
                     fmt::format("could not find finish point: {}", *toPointName)));
             }
-            PathFinder pathFinder(netlist);
+            PathFinder pathFinder(frozenNetlist);
             auto path = pathFinder.find(*fromPoint, *toPoint);
             if (path.empty()) {
                 SLANG_THROW(std::runtime_error(
@@ -0,0 +1,228 @@
+//------------------------------------------------------------------------------
+// CombLoopComponents.cpp
+// Combinatorial loop detection via strongly connected components
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "CombLoopComponents.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "slang/ast/SemanticFacts.h"
+#include "slang/util/ThreadPool.h"
+
+namespace netlist {
+
+LoopComponentSearch::LoopComponentSearch(const FrozenNetlist& graph) :
+    graph(graph), combinatorial(graph.numNodes()) {
+    // Nodes that are assigned on a clock edge break combinatorial paths.
+    for (node_id node = 0; node < graph.numNodes(); node++)
+        combinatorial[node] = graph.getNode(node).edgeKind == slang::ast::EdgeKind::None;
+}
+
+std::vector<LoopComponent> LoopComponentSearch::find(const LoopComponentOptions& options) const {
+    auto components = findComponents();
+
+    std::vector<LoopComponent> results(components.size());
+    auto search = [&](size_t index) {
+        auto& nodes = components[index];
+        auto& result = results[index];
+        result.nodes.assign(nodes.begin(), nodes.end());
+        findCycles(result, nodes, options.maxCyclesPerComponent);
+    };
+
+    if (components.size() > 1 && options.numThreads != 1) {
+        slang::ThreadPool threadPool(options.numThreads);
+        threadPool.pushLoop(size_t(0), components.size(), [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; i++)
+                search(i);
+        });
+        threadPool.waitForAll();
+    }
+    else {
+        for (size_t i = 0; i < components.size(); i++)
+            search(i);
+    }
+
+    return results;
+}
+
+std::vector<std::vector<LoopComponentSearch::node_id>> LoopComponentSearch::findComponents()
+    const {
+    // Tarjan's algorithm, with the recursion replaced by an explicit stack of
+    // nodes and the position reached in each of their successor lists.
+    constexpr uint32_t Unvisited = std::numeric_limits<uint32_t>::max();
+    const auto numNodes = graph.numNodes();
+    std::vector<uint32_t> index(numNodes, Unvisited);
+    std::vector<uint32_t> lowLink(numNodes);
+    std::vector<bool> onStack(numNodes);
+    std::vector<node_id> componentStack;
+    std::vector<std::pair<node_id, size_t>> callStack;
+    std::vector<std::vector<node_id>> components;
+    uint32_t nextIndex = 0;
+
+    auto visit = [&](node_id node) {
+        index[node] = lowLink[node] = nextIndex++;
+        componentStack.push_back(node);
+        onStack[node] = true;
+        callStack.emplace_back(node, 0);
+    };
+
+    for (node_id root = 0; root < numNodes; root++) {
+        if (index[root] != Unvisited || !combinatorial[root])
+            continue;
+
+        visit(root);
+        while (!callStack.empty()) {
+            auto [node, edgeIndex] = callStack.back();
+            auto successors = graph.successors(node);
+            if (edgeIndex < successors.size()) {
+                callStack.back().second++;
+                auto target = successors[edgeIndex];
+                if (!combinatorial[target])
+                    continue;
+
+                if (index[target] == Unvisited)
+                    visit(target);
+                else if (onStack[target])
+                    lowLink[node] = std::min(lowLink[node], index[target]);
+                continue;
+            }
+
+            // All successors are done, so return to the parent.
+            callStack.pop_back();
+            if (!callStack.empty()) {
+                auto parent = callStack.back().first;
+                lowLink[parent] = std::min(lowLink[parent], lowLink[node]);
+            }
+
+            if (lowLink[node] != index[node])
+                continue;
+
+            // This node is the root of a component; pop it off the stack.
+            std::vector<node_id> component;
+            node_id member;
+            do {
+                member = componentStack.back();
+                componentStack.pop_back();
+                onStack[member] = false;
+                component.push_back(member);
+            } while (member != node);
+
+            // Single nodes only form a loop if they feed themselves.
+            bool selfLoop = std::ranges::find(successors, node) != successors.end();
+            if (component.size() > 1 || selfLoop) {
+                std::ranges::sort(component);
+                components.push_back(std::move(component));
+            }
+        }
+    }
+
+    std::ranges::sort(components, {}, [](auto& component) { return component.front(); });
+    return components;
+}
+
+void LoopComponentSearch::findCycles(LoopComponent& result, const std::vector<node_id>& nodes,
+                                     size_t maxCycles) const {
+    // Build an adjacency list for the component using local indices, which are
+    // positions in the sorted node list, dropping edges that leave it.
+    const auto numNodes = nodes.size();
+    std::vector<std::vector<uint32_t>> adjList(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        for (auto target : graph.successors(nodes[i])) {
+            auto it = std::ranges::lower_bound(nodes, target);
+            if (it != nodes.end() && *it == target)
+                adjList[i].push_back(uint32_t(it - nodes.begin()));
+        }
+    }
+
+    // Johnson's algorithm, finding the cycles whose lowest node is s for each
+    // s in turn, with the recursive circuit search done using an explicit stack.
+    struct Frame {
+        uint32_t node;
+        size_t edgeIndex;
+        bool foundCycle;
+    };
+    std::vector<Frame> callStack;
+    std::vector<uint32_t> path;
+    std::vector<bool> blocked(numNodes);
+    std::vector<std::vector<uint32_t>> blockedBy(numNodes);
+    std::vector<uint32_t> unblockStack;
+
+    auto unblock = [&](uint32_t node) {
+        unblockStack.push_back(node);
+        while (!unblockStack.empty()) {
+            auto current = unblockStack.back();
+            unblockStack.pop_back();
+            if (!blocked[current])
+                continue;
+
+            blocked[current] = false;
+            unblockStack.insert(unblockStack.end(), blockedBy[current].begin(),
+                                blockedBy[current].end());
+            blockedBy[current].clear();
+        }
+    };
+
+    for (uint32_t s = 0; s < numNodes; s++) {
+        for (uint32_t i = s; i < numNodes; i++) {
+            blocked[i] = false;
+            blockedBy[i].clear();
+        }
+
+        blocked[s] = true;
+        path.push_back(s);
+        callStack.push_back({s, 0, false});
+        while (!callStack.empty()) {
+            auto& frame = callStack.back();
+            auto& successors = adjList[frame.node];
+            if (frame.edgeIndex < successors.size()) {
+                auto target = successors[frame.edgeIndex++];
+                if (target < s)
+                    continue;
+
+                if (target == s) {
+                    // Stop once a cycle is found beyond the limit, so that we
+                    // know there were more than we're reporting.
+                    if (maxCycles && result.cycles.size() == maxCycles) {
+                        result.limitReached = true;
+                        return;
+                    }
+
+                    auto& cycle = result.cycles.emplace_back();
+                    for (auto node : path)
+                        cycle.push_back(ID_type(nodes[node]));
+                    frame.foundCycle = true;
+                }
+                else if (!blocked[target]) {
+                    blocked[target] = true;
+                    path.push_back(target);
+                    callStack.push_back({target, 0, false});
+                }
+                continue;
+            }
+
+            auto [node, edgeIndex, foundCycle] = frame;
+            if (foundCycle) {
+                unblock(node);
+            }
+            else {
+                for (auto target : successors) {
+                    auto& list = blockedBy[target];
+                    if (target >= s && std::ranges::find(list, node) == list.end())
+                        list.push_back(node);
+                }
+            }
+
+            path.pop_back();
+            callStack.pop_back();
+            if (!callStack.empty())
+                callStack.back().foundCycle |= foundCycle;
+        }
+    }
+}
+
+} // namespace netlist
@@ -0,0 +1,179 @@
+//------------------------------------------------------------------------------
+// NetlistOutput.cpp
+// Streaming output of the netlist in DOT and binary edge list formats
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#include "NetlistOutput.h"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace netlist {
+
+OutputFile::OutputFile(const std::string& fileName, size_t bufferSize) :
+    fileName(fileName), bufferSize(bufferSize) {
+    if (fileName == "-") {
+        file = stdout;
+    }
+    else {
+        file = std::fopen(fileName.c_str(), "wb");
+        if (!file) {
+            SLANG_THROW(
+                std::runtime_error(fmt::format("unable to open '{}' for writing", fileName)));
+        }
+
+        // Output is already buffered here, so don't buffer it twice.
+        std::setvbuf(file, nullptr, _IONBF, 0);
+    }
+    buffer.reserve(bufferSize);
+}
+
+OutputFile::~OutputFile() {
+    if (file) {
+        std::fwrite(buffer.data(), 1, buffer.size(), file);
+        if (file != stdout)
+            std::fclose(file);
+        else
+            std::fflush(file);
+    }
+}
+
+void OutputFile::flush() {
+    SLANG_ASSERT(file);
+    if (std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || std::fflush(file))
+        SLANG_THROW(std::runtime_error(fmt::format("unable to write to '{}'", fileName)));
+    buffer.clear();
+}
+
+void OutputFile::close() {
+    flush();
+    auto result = file != stdout ? std::fclose(file) : 0;
+    file = nullptr;
+    if (result)
+        SLANG_THROW(std::runtime_error(fmt::format("unable to write to '{}'", fileName)));
+}
+
+void writeDOT(const Netlist& netlist, OutputFile& output) {
+    output.write("digraph {\n");
+    output.write("  node [shape=record];\n");
+    for (auto& node : netlist) {
+        switch (node->kind) {
+            case NodeKind::PortDeclaration: {
+                auto& portDecl = node->as<NetlistPortDeclaration>();
+                output.format("  N{} [label=\"Port declaration\\n{}\"]\n", node->ID,
+                              portDecl.hierarchicalPath);
+                break;
+            }
+            case NodeKind::VariableDeclaration: {
+                auto& varDecl = node->as<NetlistVariableDeclaration>();
+                output.format("  N{} [label=\"Variable declaration\\n{}\"]\n", node->ID,
+                              varDecl.hierarchicalPath);
+                break;
+            }
+            case NodeKind::VariableAlias: {
+                auto& varAlias = node->as<NetlistVariableAlias>();
+                output.format("  N{} [label=\"Variable alias\\n{}\"]\n", node->ID,
+                              varAlias.hierarchicalPath);
+                break;
+            }
+            case NodeKind::VariableReference: {
+                auto& varRef = node->as<NetlistVariableReference>();
+                if (!varRef.isLeftOperand())
+                    output.format("  N{} [label=\"{}\\n\"]\n", node->ID, varRef.toString());
+                else if (node->edgeKind == ast::EdgeKind::None)
+                    output.format("  N{} [label=\"{}\\n[Assigned to]\"]\n", node->ID,
+                                  varRef.toString());
+                else
+                    output.format("  N{} [label=\"{}\\n[Assigned to @({})]\"]\n", node->ID,
+                                  varRef.toString(), toString(node->edgeKind));
+                break;
+            }
+            default:
+                SLANG_UNREACHABLE;
+        }
+    }
+    for (auto& node : netlist) {
+        for (auto& edge : node->getEdges()) {
+            if (!edge->disabled) {
+                output.format("  N{} -> N{}\n", node->ID, edge->getTargetNode().ID);
+            }
+        }
+    }
+    output.write("}\n");
+}
+
+/// Return the name of a node that is written to the edge list. Declarations
+/// have a reference to their path, but reference names are built on demand.
+static std::string_view getNodeName(const NetlistNode& node, std::string& storage) {
+    switch (node.kind) {
+        case NodeKind::PortDeclaration:
+            return node.as<NetlistPortDeclaration>().hierarchicalPath;
+        case NodeKind::VariableDeclaration:
+            return node.as<NetlistVariableDeclaration>().hierarchicalPath;
+        case NodeKind::VariableAlias:
+            return node.as<NetlistVariableAlias>().hierarchicalPath;
+        case NodeKind::VariableReference:
+            storage = node.as<NetlistVariableReference>().toString();
+            return storage;
+        default:
+            SLANG_UNREACHABLE;
+    }
+}
+
+void writeEdgeList(const FrozenNetlist& netlist, OutputFile& output) {
+    using node_id = FrozenNetlist::node_id;
+
+    // Names are written to the string table in node order. Rather than holding
+    // onto them all, find the size of the table in a first pass and build them
+    // again as they are written out.
+    std::string storage;
+    uint64_t stringTableSize = 0;
+    for (node_id id = 0; id < netlist.numNodes(); id++)
+        stringTableSize += getNodeName(netlist.getNode(id), storage).size() + 1;
+
+    auto padding = (8 - stringTableSize % 8) % 8;
+    stringTableSize += padding;
+
+    EdgeListHeader header{};
+    std::memcpy(header.magic, EdgeListHeader::Magic, sizeof(header.magic));
+    header.version = EdgeListHeader::Version;
+    header.numNodes = netlist.numNodes();
+    header.numEdges = netlist.numEdges();
+    header.stringTableSize = stringTableSize;
+    output.write(&header, sizeof(header));
+
+    uint64_t nameOffset = 0;
+    for (node_id id = 0; id < netlist.numNodes(); id++) {
+        auto& node = netlist.getNode(id);
+        auto name = getNodeName(node, storage);
+
+        EdgeListNode record{};
+        record.nameOffset = nameOffset;
+        record.nameLength = uint32_t(name.size());
+        record.kind = uint8_t(node.kind);
+        record.edgeKind = uint8_t(node.edgeKind);
+        if (node.kind == NodeKind::VariableReference &&
+            node.as<NetlistVariableReference>().isLeftOperand()) {
+            record.flags = 1;
+        }
+        output.write(&record, sizeof(record));
+        nameOffset += name.size() + 1;
+    }
+
+    for (node_id id = 0; id < netlist.numNodes(); id++) {
+        for (auto target : netlist.successors(id)) {
+            EdgeListEdge record{id, target};
+            output.write(&record, sizeof(record));
+        }
+    }
+
+    for (node_id id = 0; id < netlist.numNodes(); id++) {
+        output.write(getNodeName(netlist.getNode(id), storage));
+        output.write("\0", 1);
+    }
+    output.write("\0\0\0\0\0\0\0", padding);
+}
+
+} // namespace netlist
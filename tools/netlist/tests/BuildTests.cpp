@@ -0,0 +1,176 @@
+//------------------------------------------------------------------------------
+//! @file BuildTests.cpp
+//! @brief Tests for building netlists in parallel.
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+
+#include "NetlistTest.h"
+
+//===---------------------------------------------------------------------===//
+// Tests for parallel netlist construction.
+//===---------------------------------------------------------------------===//
+
+/// Check that two netlists have the same nodes and edges, in the same order.
+static void checkSameNetlist(Netlist& expected, Netlist& actual) {
+    REQUIRE(actual.numNodes() == expected.numNodes());
+    REQUIRE(actual.numEdges() == expected.numEdges());
+
+    flat_hash_map<const NetlistNode*, size_t> expectedIndex, actualIndex;
+    for (size_t i = 0; i < expected.numNodes(); i++) {
+        expectedIndex.emplace(&expected.getNode(i), i);
+        actualIndex.emplace(&actual.getNode(i), i);
+    }
+
+    auto expectedFirstID = expected.getNode(0).ID;
+    auto actualFirstID = actual.getNode(0).ID;
+    for (size_t i = 0; i < expected.numNodes(); i++) {
+        auto& expectedNode = expected.getNode(i);
+        auto& actualNode = actual.getNode(i);
+        CHECK(actualNode.kind == expectedNode.kind);
+        CHECK(&actualNode.symbol == &expectedNode.symbol);
+        CHECK(actualNode.edgeKind == expectedNode.edgeKind);
+        CHECK(actualNode.ID - actualFirstID == expectedNode.ID - expectedFirstID);
+        if (expectedNode.kind == NodeKind::VariableReference) {
+            CHECK(actualNode.as<NetlistVariableReference>().toString() ==
+                  expectedNode.as<NetlistVariableReference>().toString());
+        }
+
+        auto& expectedEdges = expectedNode.getEdges();
+        auto& actualEdges = actualNode.getEdges();
+        REQUIRE(actualEdges.size() == expectedEdges.size());
+        for (size_t j = 0; j < expectedEdges.size(); j++) {
+            CHECK(actualIndex.at(&actualEdges[j]->getTargetNode()) ==
+                  expectedIndex.at(&expectedEdges[j]->getTargetNode()));
+            CHECK(actualEdges[j]->disabled == expectedEdges[j]->disabled);
+        }
+    }
+}
+
+TEST_CASE("Parallel netlist build matches the serial build") {
+    auto tree = SyntaxTree::fromText(R"(
+module test (input clk, input rst, input [7:0] in, output [7:0] out);
+  logic [7:0] a, b, d;
+  wire [7:0] c;
+
+  adder u_adder1(.x(in), .y(a), .sum(c));
+  adder u_adder2(.x(c), .y(b), .sum(out));
+
+  for (genvar i = 0; i < 4; i++) begin : gen
+    wire [1:0] g;
+    assign g = c[2*i+1:2*i];
+  end
+
+  assign b = {gen[3].g, gen[2].g, gen[1].g, gen[0].g} & a;
+
+  always_ff @(posedge clk or negedge rst) begin
+    if (!rst)
+      a <= 0;
+    else
+      a <= a + in;
+  end
+
+  always_comb begin
+    logic [7:0] t;
+    t = b;
+    for (int j = 0; j < 8; j++)
+      if (t[j])
+        d = t;
+  end
+endmodule
+
+module adder(input [7:0] x, input [7:0] y, output [7:0] sum);
+  logic [7:0] s;
+  assign s = x + y;
+  assign sum = s;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    Netlist serial;
+    buildNetlist(compilation, serial, 1);
+    serial.split();
+
+    Netlist parallel;
+    buildNetlist(compilation, parallel, 4);
+    parallel.split();
+
+    checkSameNetlist(serial, parallel);
+    CHECK(parallel.lookupVariable("test.gen[2].g") != nullptr);
+    CHECK(parallel.lookupPort("test.u_adder2.sum") != nullptr);
+
+    // Building a netlist in parallel leaves IDs allocated in order.
+    auto firstID = parallel.getNode(0).ID;
+    for (size_t i = 0; i < parallel.numNodes(); i++)
+        CHECK(parallel.getNode(i).ID == firstID + i);
+}
+
+TEST_CASE("Parallel netlist build with constant function calls") {
+    // Worker threads evaluate loop bounds and conditions that call constant
+    // functions, which share the memo table and each function's bytecode.
+    auto tree = SyntaxTree::fromText(R"(
+package p;
+  function automatic int clog2(int v);
+    int r = 0;
+    v--;
+    while (v > 0) begin
+      r++;
+      v >>= 1;
+    end
+    return r;
+  endfunction
+
+  function automatic int fib(int n);
+    return n < 2 ? n : fib(n - 1) + fib(n - 2);
+  endfunction
+endpackage
+
+module leaf #(parameter int N = 8) (input [N-1:0] in, output logic [N-1:0] out);
+  import p::*;
+  always_comb begin
+    out = 0;
+    for (int i = 0; i < clog2(N) + fib(6); i++)
+      if (i % clog2(N) == 0)
+        out[i % N] = in[i % N];
+  end
+
+  for (genvar i = 0; i < clog2(N); i++) begin : gen
+    wire w;
+    assign w = in[i];
+  end
+endmodule
+
+module test (input [15:0] in, output [15:0] out);
+  for (genvar i = 0; i < 8; i++) begin : lanes
+    leaf #(16) u_leaf(.in(in), .out());
+  end
+  leaf #(16) u_last(.in(in), .out(out));
+endmodule
+)");
+
+    CompilationOptions co;
+    co.flags |= CompilationFlags::ConstexprBytecode;
+    co.maxConstexprMemo = 1024;
+    Bag options;
+    options.set(co);
+
+    Compilation compilation(options);
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+
+    Netlist serial;
+    buildNetlist(compilation, serial, 1);
+    serial.split();
+
+    for (int i = 0; i < 4; i++) {
+        Netlist parallel;
+        buildNetlist(compilation, parallel, 8);
+        parallel.split();
+        checkSameNetlist(serial, parallel);
+    }
+
+    CHECK(compilation.getConstantMemoStats().hits > 0);
+}
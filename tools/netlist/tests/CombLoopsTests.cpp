@@ -6,6 +6,7 @@
 // SPDX-License-Identifier: MIT
 //------------------------------------------------------------------------------
 
+#include "CombLoopComponents.h"
 #include "CombLoops.h"
 #include "NetlistTest.h"
 
@@ -165,3 +166,127 @@ endmodule
               return (netlist.getNode(node).kind == NodeKind::VariableReference);
           }) == 6);
 }
+
+//===---------------------------------------------------------------------===//
+// Strongly connected component tests
+//===---------------------------------------------------------------------===//
+
+TEST_CASE("Loop components with bounded cycle enumeration") {
+    // The two loops share the assignment to a, so they form a single component.
+    auto tree = SyntaxTree::fromText(R"(
+module test (input clk, input rst);
+wire a;
+wire b;
+wire c;
+
+t2 t2(
+  .clk(clk),
+  .rst(rst),
+  .x(a),
+  .y(b),
+  .z(c)
+);
+assign a = b & c;
+endmodule
+
+module t2(input clk, input rst, input x, output y, output reg z);
+assign y = x;
+always @(posedge clk or x)
+    z <= x;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    auto graph = netlist.freeze();
+    LoopComponentSearch search(graph);
+
+    auto components = search.find();
+    REQUIRE(components.size() == 1);
+    CHECK(components[0].cycles.size() == 1);
+    CHECK(components[0].limitReached);
+
+    // The representative cycle is one of the elementary cycles.
+    ElementaryCyclesSearch ecs(netlist);
+    auto& allCycles = *ecs.getElementaryCycles();
+    CHECK(std::ranges::find(allCycles, components[0].cycles[0]) != allCycles.end());
+
+    // Without a limit, the same set of cycles as Johnson's search over the whole
+    // netlist is found.
+    components = search.find({.maxCyclesPerComponent = 0});
+    REQUIRE(components.size() == 1);
+    CHECK(!components[0].limitReached);
+    auto cycles = components[0].cycles;
+    std::ranges::sort(cycles);
+    std::ranges::sort(allCycles);
+    CHECK(cycles == allCycles);
+
+    for (auto& cycle : cycles) {
+        for (auto node : cycle)
+            CHECK(std::ranges::binary_search(components[0].nodes, node));
+    }
+}
+
+TEST_CASE("Loop components are independent of the number of threads") {
+    auto tree = SyntaxTree::fromText(R"(
+module test (input clk);
+wire a, b, c, d;
+wire e, f;
+logic g, h;
+assign a = b;
+assign b = c | a;
+assign c = d;
+assign d = c;
+assign e = f;
+assign f = e;
+always @(posedge clk)
+    g <= h;
+always @(posedge clk)
+    h <= g;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    auto graph = netlist.freeze();
+    LoopComponentSearch search(graph);
+
+    // The loop through the registers isn't combinatorial.
+    auto serial = search.find({.maxCyclesPerComponent = 0, .numThreads = 1});
+    CHECK(serial.size() == 3);
+
+    auto parallel = search.find({.maxCyclesPerComponent = 0, .numThreads = 4});
+    REQUIRE(parallel.size() == serial.size());
+    for (size_t i = 0; i < serial.size(); i++) {
+        CHECK(parallel[i].nodes == serial[i].nodes);
+        CHECK(parallel[i].cycles == serial[i].cycles);
+        CHECK(parallel[i].cycles.size() == 1);
+    }
+}
+
+TEST_CASE("Loop components in a deep chain") {
+    // A single long loop, deeper than a recursive search could handle.
+    constexpr int NumWires = 2000;
+    std::string text = "module test;\n";
+    for (int i = 0; i < NumWires; i++)
+        text += fmt::format("wire w{};\n", i);
+    for (int i = 0; i < NumWires; i++)
+        text += fmt::format("assign w{} = w{};\n", (i + 1) % NumWires, i);
+    text += "endmodule\n";
+
+    auto tree = SyntaxTree::fromText(text);
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    auto graph = netlist.freeze();
+    LoopComponentSearch search(graph);
+
+    auto components = search.find();
+    REQUIRE(components.size() == 1);
+    REQUIRE(components[0].cycles.size() == 1);
+    CHECK(components[0].cycles[0].size() == components[0].nodes.size());
+    CHECK(!components[0].limitReached);
+}
@@ -12,6 +12,10 @@
 
 using namespace netlist;
 
+// DirectedGraphTests.cpp has its own TestNode and TestEdge, so keep these local
+// to this file to avoid sharing template instantiations between the two.
+namespace {
+
 struct TestNode;
 struct TestEdge;
 
@@ -34,6 +38,8 @@ struct TestVisitor {
     void visitEdge(TestEdge& edge) { edges.push_back(&edge); };
 };
 
+} // namespace
+
 TEST_CASE("Depth-first search on a ring") {
     DirectedGraph<TestNode, TestEdge> graph;
     auto& n0 = graph.addNode();
@@ -111,3 +117,69 @@ TEST_CASE("Depth-first search with an edge predicate") {
     CHECK(*visitor.nodes[1] == n2);
     CHECK(*visitor.nodes[2] == n4);
 }
+
+struct CompactTestVisitor {
+    using node_id = CompactGraph<TestNode, TestEdge>::node_id;
+    std::vector<node_id> nodes;
+    std::vector<std::pair<node_id, node_id>> edges;
+    node_id stopNode = CompactGraph<TestNode, TestEdge>::null_node;
+    bool visitNode(node_id node) {
+        nodes.push_back(node);
+        return node != stopNode;
+    }
+    void visitEdge(node_id source, node_id target) { edges.emplace_back(source, target); }
+};
+
+TEST_CASE("Depth-first search on a compact graph") {
+    DirectedGraph<TestNode, TestEdge> graph;
+    auto& n0 = graph.addNode();
+    auto& n1 = graph.addNode();
+    auto& n2 = graph.addNode();
+    auto& n3 = graph.addNode();
+    auto& n4 = graph.addNode();
+    auto& n5 = graph.addNode();
+    auto& n6 = graph.addNode();
+    graph.addEdge(n0, n1);
+    graph.addEdge(n0, n2);
+    graph.addEdge(n1, n3);
+    graph.addEdge(n1, n4);
+    graph.addEdge(n2, n5);
+    graph.addEdge(n2, n6);
+    graph.addEdge(n6, n0);
+
+    // The compact search visits nodes in the same order as the regular one.
+    TestVisitor visitor;
+    DepthFirstSearch<TestNode, TestEdge, TestVisitor> dfs(visitor, n0);
+
+    CompactGraph<TestNode, TestEdge> compact(graph);
+    CompactTestVisitor compactVisitor;
+    CompactDepthFirstSearch dfsCompact(compactVisitor, compact, compact.getId(n0));
+    REQUIRE(compactVisitor.nodes.size() == visitor.nodes.size());
+    REQUIRE(compactVisitor.edges.size() == visitor.edges.size());
+    for (size_t i = 0; i < visitor.nodes.size(); i++)
+        CHECK(&compact.getNode(compactVisitor.nodes[i]) == visitor.nodes[i]);
+    for (size_t i = 0; i < visitor.edges.size(); i++) {
+        auto [source, target] = compactVisitor.edges[i];
+        CHECK(&compact.getNode(source) == &visitor.edges[i]->getSourceNode());
+        CHECK(&compact.getNode(target) == &visitor.edges[i]->getTargetNode());
+    }
+
+    // Stopping early.
+    CompactTestVisitor stoppingVisitor;
+    stoppingVisitor.stopNode = compact.getId(n4);
+    CompactDepthFirstSearch dfsStopping(stoppingVisitor, compact, compact.getId(n0));
+    CHECK(stoppingVisitor.nodes.size() == 4);
+    CHECK(dfsStopping.isVisited(compact.getId(n4)));
+    CHECK(!dfsStopping.isVisited(compact.getId(n2)));
+
+    // Edge predicates are applied when the compact graph is built.
+    CompactGraph<TestNode, TestEdge> filtered(
+        graph, [&n2](const TestEdge& edge) { return &edge.getTargetNode() != &n2; });
+    CHECK(filtered.numNodes() == 7);
+    CHECK(filtered.numEdges() == 6);
+    CHECK(filtered.outDegree(filtered.getId(n0)) == 1);
+    CompactTestVisitor filteredVisitor;
+    CompactDepthFirstSearch dfsFiltered(filteredVisitor, filtered, filtered.getId(n0));
+    CHECK(filteredVisitor.nodes.size() == 4);
+    CHECK(!dfsFiltered.isVisited(filtered.getId(n2)));
+}
@@ -137,6 +137,32 @@ TEST_CASE("Test removing edges") {
     CHECK(!graph.removeEdge(n2, n0));
 }
 
+TEST_CASE("Test duplicate edges and re-adding removed edges") {
+    DirectedGraph<TestNode, TestEdge> graph;
+    auto& n0 = graph.addNode();
+    auto& n1 = graph.addNode();
+    auto& n2 = graph.addNode();
+    auto& e0 = graph.addEdge(n0, n1);
+    // Adding the same edge again returns the existing edge.
+    CHECK(&graph.addEdge(n0, n1) == &e0);
+    CHECK(n0.getEdgeTo(n1) == &e0);
+    CHECK(n0.getEdgeTo(n2) == nullptr);
+    CHECK(graph.numEdges() == 1);
+    // Remove the edge and add it back.
+    CHECK(graph.removeEdge(n0, n1));
+    CHECK(n0.getEdgeTo(n1) == nullptr);
+    CHECK(n0.findEdgeTo(n1) == n0.end());
+    auto& e1 = graph.addEdge(n0, n1);
+    CHECK(n0.getEdgeTo(n1) == &e1);
+    CHECK(graph.inDegree(n1) == 1);
+    // Clearing edges also clears the index.
+    graph.addEdge(n0, n2);
+    n0.clearEdges();
+    CHECK(n0.getEdgeTo(n1) == nullptr);
+    CHECK(n0.getEdgeTo(n2) == nullptr);
+    CHECK(graph.numEdges() == 0);
+}
+
 TEST_CASE("Test iterating over nodes and node's edges") {
     DirectedGraph<TestNode, TestEdge> graph;
     auto& n0 = graph.addNode();
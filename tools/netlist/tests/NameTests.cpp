@@ -55,3 +55,60 @@ endmodule
     auto netlist = createNetlist(compilation);
     CHECK(netlist.numNodes() > 0);
 }
+
+TEST_CASE("Lookups after removing nodes and adding selectors") {
+    auto tree = SyntaxTree::fromText(R"(
+module m (input logic [3:0] a, output logic [3:0] b);
+  logic [3:0] foo, bar;
+  always_comb begin
+    foo = a;
+    foo[0] = 0;
+    bar = foo;
+  end
+  assign b = bar;
+endmodule
+)");
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+
+    auto* port = netlist.lookupPort("m.a");
+    auto* var = netlist.lookupVariable("m.foo");
+    auto* fooRef = netlist.lookupVariableReference("foo[0]");
+    REQUIRE(port);
+    REQUIRE(var);
+    REQUIRE(fooRef);
+    REQUIRE(netlist.lookupVariableReference("bar"));
+
+    // Removed nodes can no longer be found, and nodes that have moved
+    // within the netlist still can.
+    auto numNodes = netlist.numNodes();
+    const NetlistNode* removed[] = {port, var, fooRef};
+    CHECK(netlist.removeNode(*port));
+    CHECK(netlist.removeNode(*var));
+    CHECK(netlist.removeNode(*fooRef));
+    CHECK(netlist.numNodes() == numNodes - 3);
+    CHECK(netlist.lookupPort("m.a") == nullptr);
+    CHECK(netlist.lookupVariable("m.foo") == nullptr);
+    CHECK(netlist.lookupVariableReference("foo[0]") == nullptr);
+    CHECK(netlist.lookupPort("m.b") != nullptr);
+    CHECK(netlist.lookupVariable("m.bar") != nullptr);
+
+    // No remaining node has an edge to a removed node.
+    for (auto& node : netlist) {
+        for (auto& edge : node->getEdges()) {
+            auto* target = &edge->getTargetNode();
+            CHECK(target != removed[0]);
+            CHECK(target != removed[1]);
+            CHECK(target != removed[2]);
+        }
+    }
+
+    // Adding a selector after a lookup changes the syntax the node is found by.
+    auto* barRef = netlist.lookupVariableReference("bar");
+    REQUIRE(barRef);
+    netlist.addMemberAccess(*barRef, "x");
+    CHECK(netlist.lookupVariableReference("bar.x") == barRef);
+    CHECK(netlist.lookupVariableReference("bar") != barRef);
+}
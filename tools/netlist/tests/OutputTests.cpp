@@ -0,0 +1,117 @@
+//------------------------------------------------------------------------------
+//! @file OutputTests.cpp
+//! @brief Tests for writing netlists to files.
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+
+#include "NetlistOutput.h"
+#include "NetlistTest.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+//===---------------------------------------------------------------------===//
+// Tests for netlist output formats.
+//===---------------------------------------------------------------------===//
+
+static std::string readFile(const std::filesystem::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+static const char* OutputTestDesign = R"(
+module test(input clk, input [3:0] a, output [3:0] b);
+  logic [3:0] r;
+  always_ff @(posedge clk)
+    r <= a;
+  assign b = r;
+endmodule
+)";
+
+TEST_CASE("DOT output is streamed through a bounded buffer") {
+    auto tree = SyntaxTree::fromText(OutputTestDesign);
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+
+    auto path = std::filesystem::temp_directory_path() / "slang_netlist_test.dot";
+    auto writeWithBuffer = [&](size_t bufferSize) {
+        OutputFile output(path.string(), bufferSize);
+        writeDOT(netlist, output);
+        output.close();
+        return readFile(path);
+    };
+
+    auto text = writeWithBuffer(OutputFile::DefaultBufferSize);
+    CHECK(text == writeWithBuffer(16));
+    CHECK(text.starts_with("digraph {\n"));
+    CHECK(text.ends_with("\n}\n"));
+
+    size_t numEdgeLines = 0;
+    for (size_t pos = 0; (pos = text.find(" -> ", pos)) != std::string::npos; pos++)
+        numEdgeLines++;
+    CHECK(numEdgeLines == netlist.freeze().numEdges());
+    std::filesystem::remove(path);
+}
+
+TEST_CASE("Binary edge list output") {
+    auto tree = SyntaxTree::fromText(OutputTestDesign);
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    NO_COMPILATION_ERRORS;
+    auto netlist = createNetlist(compilation);
+    auto frozen = netlist.freeze();
+
+    auto path = std::filesystem::temp_directory_path() / "slang_netlist_test.edges";
+    {
+        OutputFile output(path.string(), 32);
+        writeEdgeList(frozen, output);
+        output.close();
+    }
+    auto data = readFile(path);
+    std::filesystem::remove(path);
+
+    EdgeListHeader header;
+    REQUIRE(data.size() >= sizeof(header));
+    std::memcpy(&header, data.data(), sizeof(header));
+    CHECK(std::memcmp(header.magic, EdgeListHeader::Magic, sizeof(header.magic)) == 0);
+    CHECK(header.version == EdgeListHeader::Version);
+    CHECK(header.numNodes == frozen.numNodes());
+    CHECK(header.numEdges == frozen.numEdges());
+    CHECK(header.stringTableSize % 8 == 0);
+
+    auto nodesOffset = sizeof(EdgeListHeader);
+    auto edgesOffset = nodesOffset + header.numNodes * sizeof(EdgeListNode);
+    auto stringsOffset = edgesOffset + header.numEdges * sizeof(EdgeListEdge);
+    REQUIRE(data.size() == stringsOffset + header.stringTableSize);
+
+    for (uint32_t i = 0; i < header.numNodes; i++) {
+        EdgeListNode record;
+        std::memcpy(&record, data.data() + nodesOffset + i * sizeof(record), sizeof(record));
+        auto& node = frozen.getNode(i);
+        CHECK(record.kind == uint8_t(node.kind));
+        CHECK(record.edgeKind == uint8_t(node.edgeKind));
+
+        std::string_view name(data.data() + stringsOffset + record.nameOffset, record.nameLength);
+        CHECK(data[stringsOffset + record.nameOffset + record.nameLength] == '\0');
+        if (node.kind == NodeKind::VariableDeclaration)
+            CHECK(name == node.as<NetlistVariableDeclaration>().hierarchicalPath);
+        else if (node.kind == NodeKind::VariableReference)
+            CHECK(name == node.as<NetlistVariableReference>().toString());
+    }
+
+    size_t edgeIndex = 0;
+    for (uint32_t i = 0; i < header.numNodes; i++) {
+        for (auto target : frozen.successors(i)) {
+            EdgeListEdge record;
+            std::memcpy(&record, data.data() + edgesOffset + edgeIndex++ * sizeof(record),
+                        sizeof(record));
+            CHECK(record.source == i);
+            CHECK(record.target == target);
+        }
+    }
+}
@@ -93,6 +93,14 @@ endmodule
     CHECK(*path.findVariable("chain_vars.c") == 5);
     CHECK(*path.findVariable("chain_vars.d") == 7);
     CHECK(*path.findVariable("chain_vars.e") == 9);
+
+    // The same path is found on an explicitly frozen netlist.
+    auto frozenNetlist = netlist.freeze();
+    CHECK(frozenNetlist.numNodes() == netlist.numNodes());
+    PathFinder frozenPathFinder(frozenNetlist);
+    auto frozenPath = frozenPathFinder.find(*netlist.lookupPort("chain_vars.i_value"),
+                                            *netlist.lookupPort("chain_vars.o_value"));
+    CHECK(std::ranges::equal(frozenPath, path));
 }
 
 TEST_CASE("Chain of assignments in a sequence using a vector") {
@@ -0,0 +1,66 @@
+//------------------------------------------------------------------------------
+//! @file TidyDispatcher.h
+//! @brief Shared AST traversal for slang-tidy checks
+//
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+//------------------------------------------------------------------------------
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "slang/ast/ASTVisitor.h"
+
+/// Runs callbacks that checks register for specific AST node types, for all of
+/// those checks in a single traversal of the design.
+///
+/// Every node is visited, including statements and expressions, regardless of
+/// what callbacks are registered for it. A callback therefore can't control
+/// the traversal the way a handler in a check's own visitor can by not calling
+/// visitDefault; checks that rely on that should keep running their own
+/// traversal from TidyCheck::check instead.
+class TidyDispatcher : public slang::ast::ASTVisitor<TidyDispatcher, true, true> {
+public:
+    /// Registers @a callback to be called for every node of type @a T.
+    template<typename T>
+    void add(std::function<void(const T&)> callback) {
+        auto index = typeIndex<T>();
+        if (index >= callbacks.size())
+            callbacks.resize(index + 1);
+
+        callbacks[index].emplace_back([callback = std::move(callback)](const void* node) {
+            callback(*static_cast<const T*>(node));
+        });
+        numCallbacks++;
+    }
+
+    /// Returns true if no callbacks have been registered.
+    bool empty() const { return numCallbacks == 0; }
+
+    template<typename T>
+    void handle(const T& node) {
+        if (auto index = typeIndex<T>(); index < callbacks.size()) {
+            for (auto& callback : callbacks[index])
+                callback(&node);
+        }
+        visitDefault(node);
+    }
+
+private:
+    // Node types are given dense indices on first use, so that finding the
+    // callbacks for a node is a single vector lookup.
+    static size_t nextTypeIndex() {
+        static size_t count = 0;
+        return count++;
+    }
+
+    template<typename T>
+    static size_t typeIndex() {
+        static const size_t index = nextTypeIndex();
+        return index;
+    }
+
+    std::vector<std::vector<std::function<void(const void*)>>> callbacks;
+    size_t numCallbacks = 0;
+};
@@ -20,6 +20,7 @@
 #include "slang/util/Util.h"
 
 class TidyCheck;
+class TidyDispatcher;
 
 class Registry {
 public:
@@ -101,6 +102,12 @@ public:
     /// Returns true if the check didn't find any errors, false otherwise
     [[nodiscard]] virtual bool check(const slang::ast::RootSymbol& root) = 0;
 
+    /// Registers the check's node callbacks with @a dispatcher, so that it runs as
+    /// part of the traversal shared by all such checks instead of doing its own.
+    /// Returns false if the check doesn't support this, in which case check() is
+    /// called instead. Either way the results end up in getDiagnostics().
+    virtual bool registerCallbacks(TidyDispatcher&) { return false; }
+
     virtual std::string name() const = 0;
     virtual std::string description() const = 0;
     virtual std::string shortDescription() const = 0;
@@ -3,6 +3,7 @@
 
 #include "ASTHelperVisitors.h"
 #include "TidyDiags.h"
+#include "TidyDispatcher.h"
 #include "fmt/color.h"
 #include "fmt/ranges.h"
 
@@ -66,6 +67,14 @@ public:
         return true;
     }
 
+    bool registerCallbacks(TidyDispatcher& dispatcher) override {
+        dispatcher.add<PortSymbol>(
+            [visitor = MainVisitor(diagnostics)](const PortSymbol& port) mutable {
+                visitor.handle(port);
+            });
+        return true;
+    }
+
     DiagCode diagCode() const override { return diag::EnforcePortSuffix; }
     DiagnosticSeverity diagSeverity() const override { return DiagnosticSeverity::Warning; }
     std::string diagString() const override {
@@ -3,6 +3,7 @@
 
 #include "ASTHelperVisitors.h"
 #include "TidyDiags.h"
+#include "TidyDispatcher.h"
 
 #include "slang/syntax/AllSyntax.h"
 
@@ -36,6 +37,14 @@ public:
         return true;
     }
 
+    bool registerCallbacks(TidyDispatcher& dispatcher) override {
+        dispatcher.add<PortSymbol>(
+            [visitor = MainVisitor(diagnostics)](const PortSymbol& port) mutable {
+                visitor.handle(port);
+            });
+        return true;
+    }
+
     DiagCode diagCode() const override { return diag::OnlyANSIPortDecl; }
     DiagnosticSeverity diagSeverity() const override { return DiagnosticSeverity::Warning; }
     std::string diagString() const override {
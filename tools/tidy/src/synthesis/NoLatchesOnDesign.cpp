@@ -3,6 +3,7 @@
 
 #include "ASTHelperVisitors.h"
 #include "TidyDiags.h"
+#include "TidyDispatcher.h"
 #include "fmt/color.h"
 
 #include "slang/syntax/AllSyntax.h"
@@ -42,6 +43,14 @@ public:
         return true;
     }
 
+    bool registerCallbacks(TidyDispatcher& dispatcher) override {
+        dispatcher.add<VariableSymbol>(
+            [visitor = MainVisitor(diagnostics)](const VariableSymbol& symbol) mutable {
+                visitor.handle(symbol);
+            });
+        return true;
+    }
+
     DiagCode diagCode() const override { return diag::NoLatchesOnDesign; }
 
     std::string diagString() const override { return "latches are not allowed in this design"; }
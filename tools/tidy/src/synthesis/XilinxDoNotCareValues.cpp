@@ -3,6 +3,7 @@
 
 #include "ASTHelperVisitors.h"
 #include "TidyDiags.h"
+#include "TidyDispatcher.h"
 #include "TidyFactory.h"
 #include "fmt/color.h"
 
@@ -39,6 +40,14 @@ public:
         return diagnostics.empty();
     }
 
+    bool registerCallbacks(TidyDispatcher& dispatcher) override {
+        dispatcher.add<IntegerLiteral>(
+            [visitor = MainVisitor(diagnostics)](const IntegerLiteral& expr) mutable {
+                visitor.handle(expr);
+            });
+        return true;
+    }
+
     DiagCode diagCode() const override { return diag::XilinxDoNotCareValues; }
 
     std::string diagString() const override {
@@ -7,15 +7,18 @@
 //------------------------------------------------------------------------------
 
 #include "TidyConfigParser.h"
+#include "TidyDispatcher.h"
 #include "TidyFactory.h"
 #include "fmt/color.h"
 #include "fmt/format.h"
 #include <filesystem>
+#include <fstream>
 #include <unordered_set>
 
 #include "slang/ast/Compilation.h"
 #include "slang/diagnostics/TextDiagnosticClient.h"
 #include "slang/driver/Driver.h"
+#include "slang/util/TimeTrace.h"
 #include "slang/util/VersionInfo.h"
 
 /// Performs a search for the .slang-tidy file on the current directory. If the file is not found,
@@ -51,6 +54,12 @@ int main(int argc, char** argv) {
     std::vector<std::string> skippedPaths;
     driver.cmdLine.add("--skip-path", skippedPaths, "Paths to be skipped by slang-tidy");
 
+    std::optional<std::string> timeTrace;
+    driver.cmdLine.add("--time-trace", timeTrace,
+                       "Do performance profiling of compilation and of each check and output "
+                       "the results to the given file in Chrome Event Tracing JSON format",
+                       "<path>");
+
     if (!driver.parseCommandLine(argc, argv))
         return 1;
 
@@ -115,10 +124,26 @@ int main(int argc, char** argv) {
     if (!driver.processOptions())
         return 1;
 
+    // The checks inspect the bodies and drivers of every instance, so each
+    // one needs to be fully elaborated instead of sharing another's results.
+    if (driver.options.compilationFlags[ast::CompilationFlags::EnableInstanceCaching] == true) {
+        slang::OS::printE("slang-tidy: --enable-instance-caching is not supported, since checks "
+                          "need every instance to be fully elaborated\n");
+        return 1;
+    }
+
+    if (timeTrace)
+        TimeTrace::initialize();
+
     std::unique_ptr<ast::Compilation> compilation;
     bool compilationOk;
     SLANG_TRY {
-        compilationOk = driver.parseAllSources();
+        {
+            TimeTraceScope timeScope("parseAllSources"sv, ""sv);
+            compilationOk = driver.parseAllSources();
+        }
+
+        TimeTraceScope timeScope("elaboration"sv, ""sv);
         compilation = driver.createCompilation();
         compilationOk &= driver.reportCompilation(*compilation, true);
     }
@@ -139,17 +164,44 @@ int main(int argc, char** argv) {
     // Set the sourceManager to the Registry so checks can access it
     Registry::setSourceManager(compilation->getSourceManager());
 
-    int retCode = 0;
-
-    // Check all enabled checks
+    // Checks that support it register callbacks with a shared dispatcher and are
+    // all run by a single traversal of the design; the others each do their own.
+    std::vector<std::unique_ptr<TidyCheck>> checks;
+    std::vector<bool> dispatched;
+    std::string dispatchedNames;
+    TidyDispatcher dispatcher;
     for (const auto& checkName : Registry::getEnabledChecks()) {
-        const auto check = Registry::create(checkName);
+        auto& check = checks.emplace_back(Registry::create(checkName));
+        dispatched.push_back(check->registerCallbacks(dispatcher));
+        if (dispatched.back()) {
+            if (!dispatchedNames.empty())
+                dispatchedNames += ", ";
+            dispatchedNames += check->name();
+        }
+    }
+
+    if (!dispatcher.empty()) {
+        TimeTraceScope timeScope("checks"sv, dispatchedNames);
+        compilation->getRoot().visit(dispatcher);
+    }
+
+    int retCode = 0;
+    for (size_t i = 0; i < checks.size(); i++) {
+        auto& check = checks[i];
         OS::print(fmt::format("[{}]", check->name()));
 
         driver.diagEngine.setMessage(check->diagCode(), check->diagString());
         driver.diagEngine.setSeverity(check->diagCode(), check->diagSeverity());
 
-        auto checkOk = check->check(compilation->getRoot());
+        bool checkOk;
+        if (dispatched[i]) {
+            checkOk = check->getDiagnostics().empty();
+        }
+        else {
+            TimeTraceScope timeScope("check"sv, [&] { return check->name(); });
+            checkOk = check->check(compilation->getRoot());
+        }
+
         if (!checkOk) {
             retCode = 1;
             OS::print(fmt::emphasis::bold | fmt::fg(fmt::color::red), " FAIL\n");
@@ -163,6 +215,15 @@ int main(int argc, char** argv) {
         }
     }
 
+    if (timeTrace) {
+        std::ofstream file(*timeTrace);
+        TimeTrace::write(file);
+        if (!file.flush()) {
+            slang::OS::printE(fmt::format("unable to write time trace to '{}'\n", *timeTrace));
+            return 1;
+        }
+    }
+
     return retCode;
 }
 
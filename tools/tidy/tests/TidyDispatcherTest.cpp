@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: Michael Popoloski
+// SPDX-License-Identifier: MIT
+
+#include "Test.h"
+#include "TidyDispatcher.h"
+#include "TidyFactory.h"
+
+TEST_CASE("TidyDispatcher: Shared traversal matches running each check") {
+    auto tree = SyntaxTree::fromText(R"(
+module top(a, b, c);
+    input logic a;
+    output logic b;
+    output logic c;
+
+    logic [3:0] d = 4'b?;
+    logic e;
+    always_latch begin
+        if (a)
+            e <= a;
+    end
+
+    sub s(.x_i(a), .y_o(c));
+endmodule
+
+module sub(input logic x_i, output logic y_o, input logic bad);
+    logic [3:0] f;
+    always_comb f = 4'd?;
+endmodule
+)");
+
+    Compilation compilation;
+    compilation.addSyntaxTree(tree);
+    compilation.getAllDiagnostics();
+    auto& root = compilation.getRoot();
+
+    TidyConfig config;
+    Registry::setConfig(config);
+    Registry::setSourceManager(compilation.getSourceManager());
+
+    auto getLocations = [](const TidyCheck& check) {
+        std::vector<SourceLocation> locations;
+        for (auto& diag : check.getDiagnostics())
+            locations.push_back(diag.location);
+        return locations;
+    };
+
+    std::vector<std::unique_ptr<TidyCheck>> dispatched;
+    TidyDispatcher dispatcher;
+    for (auto name : {"OnlyANSIPortDecl", "EnforcePortSuffix", "NoLatchesOnDesign",
+                      "XilinxDoNotCareValues"}) {
+        auto& check = dispatched.emplace_back(Registry::create(name));
+        CHECK(check->registerCallbacks(dispatcher));
+    }
+    CHECK_FALSE(dispatcher.empty());
+    root.visit(dispatcher);
+
+    for (auto& check : dispatched) {
+        auto standalone = Registry::create(check->name());
+        CHECK_FALSE(standalone->check(root));
+        CHECK(getLocations(*check) == getLocations(*standalone));
+    }
+}
+
+TEST_CASE("TidyDispatcher: Checks that need their own traversal") {
+    TidyDispatcher dispatcher;
+    auto check = Registry::create("CastSignedIndex");
+    CHECK_FALSE(check->registerCallbacks(dispatcher));
+    CHECK(dispatcher.empty());
+}